@@ -0,0 +1,150 @@
+#ifndef VOICE_ENGINE_BENCH_RUNNER_HPP
+#define VOICE_ENGINE_BENCH_RUNNER_HPP
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <chrono>
+#include <algorithm>
+#include <numeric>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstdint>
+
+namespace bench {
+    // Derleyicinin ölçülen sonucu atmasını engeller
+    template <typename T>
+    inline void keep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    using Params = std::vector<std::pair<std::string, std::string>>;
+
+    struct Result {
+        std::string name;
+        Params params;
+        uint64_t iterations = 0;     // Tekrar başına iterasyon
+        double ns_median = 0.0;      // İterasyon başına
+        double ns_min = 0.0;
+        double ns_mean = 0.0;
+        double items_per_iteration = 1.0;
+    };
+
+    // Basit mikro ölçüm çalıştırıcısı: iterasyon sayısı min_time'a ulaşacak şekilde kalibre edilir,
+    // ardından repetitions kez ölçülür ve iterasyon başına ns medyan/min/ortalama raporlanır.
+    class Runner {
+    public:
+        std::chrono::milliseconds min_time{200};
+        int repetitions = 5;
+        std::string filter;
+        bool list_only = false;
+
+        // body(iterations): iterations kez ölçülen işlemi çalıştırır
+        template <typename Body>
+        void run(const std::string& name, const Params& params, double items_per_iteration, Body&& body) {
+            const std::string full_name = display_name(name, params);
+            if (!filter.empty() && full_name.find(filter) == std::string::npos) { return; }
+            if (list_only) {
+                std::cout << full_name << std::endl;
+                return;
+            }
+
+            uint64_t iterations = 1;
+            const double target_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(min_time).count());
+            for (;;) {
+                const double elapsed = time_ns(body, iterations);
+                if (elapsed >= target_ns || iterations >= (1ull << 40)) { break; }
+                // Hedefe orantılı büyüt (en az 2x, en fazla 10x)
+                const double scale = elapsed > 0.0 ? std::clamp(target_ns * 1.2 / elapsed, 2.0, 10.0) : 10.0;
+                iterations = static_cast<uint64_t>(static_cast<double>(iterations) * scale);
+            }
+
+            std::vector<double> per_iteration;
+            for (int r = 0; r < std::max(repetitions, 1); ++r) {
+                per_iteration.push_back(time_ns(body, iterations) / static_cast<double>(iterations));
+            }
+            std::sort(per_iteration.begin(), per_iteration.end());
+
+            Result result;
+            result.name = name;
+            result.params = params;
+            result.iterations = iterations;
+            result.ns_min = per_iteration.front();
+            result.ns_median = per_iteration[per_iteration.size() / 2];
+            result.ns_mean = std::accumulate(per_iteration.begin(), per_iteration.end(), 0.0) / per_iteration.size();
+            result.items_per_iteration = items_per_iteration;
+            results_.push_back(result);
+
+            std::cout << std::left << std::setw(56) << full_name << std::right << std::fixed << std::setprecision(1)
+                      << std::setw(14) << result.ns_median << " ns" << std::setw(14) << result.ns_min << " ns"
+                      << std::setw(12) << iterations << std::endl;
+        }
+
+        const std::vector<Result>& results() const { return results_; }
+
+        bool write_json(const std::string& path, const std::string& version, const std::string& simd) const {
+            std::ofstream out(path);
+            if (!out) {
+                std::cerr << "HATA: JSON dosyası yazılamadı: " << path << std::endl;
+                return false;
+            }
+            out << "{\n  \"version\": \"" << escape(version) << "\",\n"
+                << "  \"simd\": \"" << escape(simd) << "\",\n"
+                << "  \"min_time_ms\": " << min_time.count() << ",\n"
+                << "  \"repetitions\": " << repetitions << ",\n"
+                << "  \"benchmarks\": [\n";
+            for (size_t i = 0; i < results_.size(); ++i) {
+                const Result& r = results_[i];
+                out << "    {\"name\": \"" << escape(r.name) << "\", \"params\": {";
+                for (size_t p = 0; p < r.params.size(); ++p) {
+                    out << (p ? ", " : "") << "\"" << escape(r.params[p].first) << "\": \"" << escape(r.params[p].second) << "\"";
+                }
+                out << "}, \"iterations\": " << r.iterations
+                    << std::fixed << std::setprecision(2)
+                    << ", \"ns_per_op\": {\"median\": " << r.ns_median << ", \"min\": " << r.ns_min << ", \"mean\": " << r.ns_mean << "}"
+                    << ", \"items_per_second\": " << (r.ns_median > 0.0 ? r.items_per_iteration * 1e9 / r.ns_median : 0.0)
+                    << "}" << (i + 1 < results_.size() ? "," : "") << "\n";
+            }
+            out << "  ]\n}\n";
+            return static_cast<bool>(out);
+        }
+
+        static std::string display_name(const std::string& name, const Params& params) {
+            std::string full = name;
+            for (const auto& param : params) {
+                full += "/" + param.first + "=" + param.second;
+            }
+            return full;
+        }
+
+    private:
+        template <typename Body>
+        static double time_ns(Body& body, uint64_t iterations) {
+            const auto start = std::chrono::steady_clock::now();
+            body(iterations);
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count());
+        }
+
+        static std::string escape(const std::string& text) {
+            std::ostringstream out;
+            for (char c : text) {
+                if (c == '"' || c == '\\') { out << '\\' << c; }
+                else if (static_cast<unsigned char>(c) < 0x20) { out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec; }
+                else { out << c; }
+            }
+            return out.str();
+        }
+
+        std::vector<Result> results_;
+    };
+}
+
+#endif
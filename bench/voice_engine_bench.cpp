@@ -0,0 +1,420 @@
+#include "bench_runner.hpp"
+#include "codec/opus_codec.hpp"
+#include "core/latency_histogram.hpp"
+#include "core/packet.hpp"
+#include "streaming/slicer.hpp"
+#include "streaming/collector.hpp"
+#include "processing/audio_frame.hpp"
+#include "processing/audio_gain_controller.hpp"
+#include "processing/capture_pipeline.hpp"
+#include "processing/dsp_kernels.hpp"
+#include "processing/echo_canceller.hpp"
+#include "processing/fft.hpp"
+#include "processing/noise_suppressor.hpp"
+#include "processing/resampler.hpp"
+#include "processing/time_scale_modifier.hpp"
+#include "processing/spectral_noise_suppressor.hpp"
+#include "processing/voice_activity_detector.hpp"
+#include "playback/audio_player.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <memory>
+
+#ifndef VOICE_ENGINE_VERSION
+#define VOICE_ENGINE_VERSION "unknown"
+#endif
+
+namespace {
+    constexpr int SAMPLE_RATE = 48000;
+    constexpr size_t FRAME_SAMPLES = 480;
+    constexpr size_t SIGNAL_FRAMES = 100; // 1 saniyelik döngüsel girdi
+
+    // Konuşmaya benzer sentetik sinyal: titreşimli temel frekans + harmonikler + gürültü,
+    // hece benzeri genlik zarfı. Sabit seed: sürümler arasında aynı girdi.
+    std::vector<int16_t> make_signal(size_t frames, uint32_t seed, float level = 6000.0f) {
+        std::mt19937 rng(seed);
+        std::normal_distribution<float> noise(0.0f, 150.0f);
+        std::vector<int16_t> samples(frames * FRAME_SAMPLES);
+        double phase = 0.0;
+        for (size_t i = 0; i < samples.size(); ++i) {
+            const double t = static_cast<double>(i) / SAMPLE_RATE;
+            const double f0 = 140.0 + 20.0 * std::sin(2.0 * M_PI * 3.0 * t);
+            phase += 2.0 * M_PI * f0 / SAMPLE_RATE;
+            const double envelope = 0.5 + 0.5 * std::sin(2.0 * M_PI * 4.0 * t);
+            double v = 0.0;
+            for (int h = 1; h <= 8; ++h) {
+                v += std::sin(phase * h) / h;
+            }
+            samples[i] = static_cast<int16_t>(std::clamp(level * envelope * v / 2.0 + noise(rng), -32768.0, 32767.0));
+        }
+        return samples;
+    }
+
+    const int16_t* frame_at(const std::vector<int16_t>& signal, uint64_t index) {
+        return signal.data() + (index % (signal.size() / FRAME_SAMPLES)) * FRAME_SAMPLES;
+    }
+
+    void bench_codec(bench::Runner& runner, const std::vector<int16_t>& signal) {
+        for (int complexity : {0, 5, 10}) {
+            for (int bitrate : {16000, 32000, 64000}) {
+                const bench::Params params = {{"complexity", std::to_string(complexity)}, {"bitrate", std::to_string(bitrate)}};
+
+                codec::OpusCodec codec(SAMPLE_RATE, 1);
+                codec.set_complexity(complexity);
+                codec.set_bitrate(bitrate);
+                std::vector<uint8_t> out(codec::OpusCodec::MAX_PACKET_SIZE);
+                runner.run("opus_encode", params, 1.0, [&](uint64_t n) {
+                    for (uint64_t i = 0; i < n; ++i) {
+                        bench::keep(codec.encode(frame_at(signal, i), FRAME_SAMPLES, out.data(), out.size()));
+                    }
+                });
+
+                // Decode girdisi aynı ayarlarla bir kez encode edilir
+                std::vector<std::vector<uint8_t>> packets;
+                for (size_t f = 0; f < SIGNAL_FRAMES; ++f) {
+                    const size_t size = codec.encode(frame_at(signal, f), FRAME_SAMPLES, out.data(), out.size());
+                    packets.emplace_back(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(size));
+                }
+                std::vector<int16_t> pcm(codec.max_decoded_samples());
+                runner.run("opus_decode", params, 1.0, [&](uint64_t n) {
+                    for (uint64_t i = 0; i < n; ++i) {
+                        const auto& packet = packets[i % packets.size()];
+                        bench::keep(codec.decode(packet.data(), packet.size(), pcm.data(), pcm.size()));
+                    }
+                });
+            }
+        }
+    }
+
+    void bench_packets(bench::Runner& runner) {
+        std::vector<uint8_t> payload(160);
+        for (size_t i = 0; i < payload.size(); ++i) { payload[i] = static_cast<uint8_t>(i); }
+
+        for (size_t size : {160u, 1200u, 3000u}) {
+            std::vector<uint8_t> data(size, 0x5A);
+            streaming::Slicer slicer(0x1234u);
+            std::vector<core::PacketView> views;
+            runner.run("slicer_slice", {{"payload", std::to_string(size)}, {"max_slice", "1000"}}, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) {
+                    slicer.slice(data.data(), data.size(), 1000, static_cast<uint32_t>(i * FRAME_SAMPLES), false, views);
+                    bench::keep(views.size());
+                }
+            });
+        }
+
+        core::Packet packet;
+        packet.sequence_number = 42;
+        packet.timestamp = 48000;
+        packet.ssrc = 0xCAFEBABE;
+        packet.data = payload;
+        runner.run("packet_to_bytes", {{"payload", "160"}}, 1.0, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                auto bytes = packet.to_bytes();
+                bench::keep(bytes);
+            }
+        });
+        const std::vector<uint8_t> wire = packet.to_bytes();
+        runner.run("packet_from_bytes", {{"payload", "160"}}, 1.0, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                auto parsed = core::Packet::from_bytes(wire);
+                bench::keep(parsed);
+            }
+        });
+
+        const core::PacketView view = packet.view();
+        std::vector<uint8_t> datagram(2048);
+        runner.run("packetview_serialize", {{"payload", "160"}}, 1.0, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                bench::keep(view.serialize(datagram.data(), datagram.size()));
+            }
+        });
+        runner.run("packetview_parse", {{"payload", "160"}}, 1.0, [&](uint64_t n) {
+            core::PacketView parsed;
+            for (uint64_t i = 0; i < n; ++i) {
+                bench::keep(core::PacketView::parse(wire.data(), wire.size(), parsed));
+            }
+        });
+    }
+
+    // Collector: sanal saatle 10ms aralıklı varış. Desen PATTERN_SIZE paketlik bloklar halinde tekrarlanır.
+    void bench_collector(bench::Runner& runner) {
+        constexpr size_t PATTERN_SIZE = 4096;
+        struct Arrival { uint32_t index; uint32_t slot; int32_t jitter_us; }; // slot: varış sırası (10ms adım)
+
+        auto make_pattern = [](const std::string& mode) {
+            std::mt19937 rng(7);
+            std::vector<Arrival> pattern;
+            for (uint32_t i = 0; i < PATTERN_SIZE; ++i) {
+                if (mode == "lossy" && std::uniform_int_distribution<int>(0, 99)(rng) < 5) { continue; } // %5 kayıp
+                pattern.push_back({i, i, 0});
+            }
+            if (mode == "reordered") {
+                // Her 4 paketlik grupta ikili yer değiştirme + 0-8ms varış jitter'ı
+                for (size_t i = 0; i + 1 < pattern.size(); i += 4) {
+                    std::swap(pattern[i].index, pattern[i + 1].index);
+                }
+                for (auto& arrival : pattern) {
+                    arrival.jitter_us = std::uniform_int_distribution<int32_t>(0, 8000)(rng);
+                }
+            }
+            return pattern;
+        };
+
+        std::vector<uint8_t> payload(120, 0x11);
+        for (const std::string mode : {"in_order", "reordered", "lossy"}) {
+            const std::vector<Arrival> pattern = make_pattern(mode);
+            streaming::Collector collector;
+            collector.set_loss_callback([](const std::vector<uint8_t>& next) { bench::keep(next); });
+            const auto origin = streaming::Collector::Clock::now();
+            uint64_t position = 0;
+            auto on_collected = [](const std::vector<uint8_t>& data) { bench::keep(data); };
+
+            runner.run("collector_collect", {{"arrival", mode}}, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i, ++position) {
+                    const Arrival& arrival = pattern[position % pattern.size()];
+                    const uint64_t cycle = (position / pattern.size()) * PATTERN_SIZE;
+                    const uint64_t index = cycle + arrival.index;
+                    core::PacketView view;
+                    view.sequence_number = static_cast<uint32_t>(index & 0xFFFF);
+                    view.timestamp = static_cast<uint32_t>(index * FRAME_SAMPLES);
+                    view.ssrc = 0x1234;
+                    view.payload = payload.data();
+                    view.payload_size = payload.size();
+                    const auto when = origin + std::chrono::microseconds(static_cast<int64_t>(cycle + arrival.slot) * 10000 + arrival.jitter_us);
+                    collector.collect(view, on_collected, when);
+                }
+            });
+        }
+    }
+
+    void bench_processing(bench::Runner& runner, const std::vector<int16_t>& signal, const std::vector<int16_t>& far_signal) {
+        std::vector<int16_t> frame(FRAME_SAMPLES);
+
+        for (int tail_ms : {128, 256, 512}) {
+            processing::EchoCanceller canceller(tail_ms, SAMPLE_RATE);
+            runner.run("echo_canceller_process", {{"tail_ms", std::to_string(tail_ms)}}, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) {
+                    canceller.on_playback(frame_at(far_signal, i), FRAME_SAMPLES);
+                    std::copy(frame_at(signal, i), frame_at(signal, i) + FRAME_SAMPLES, frame.begin());
+                    canceller.process(frame.data(), frame.size());
+                    bench::keep(frame);
+                }
+            });
+        }
+
+        for (auto engine : {processing::NoiseSuppressor::Engine::Gate, processing::NoiseSuppressor::Engine::Spectral}) {
+            processing::NoiseSuppressor suppressor(engine);
+            const char* engine_name = engine == processing::NoiseSuppressor::Engine::Gate ? "gate" : "spectral";
+            runner.run("noise_suppressor_process", {{"engine", engine_name}}, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) {
+                    frame.assign(frame_at(signal, i), frame_at(signal, i) + FRAME_SAMPLES);
+                    suppressor.process(frame);
+                    bench::keep(frame);
+                }
+            });
+        }
+
+        processing::VoiceActivityDetector vad;
+        runner.run("vad_detect_voice", {}, 1.0, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                frame.assign(frame_at(signal, i), frame_at(signal, i) + FRAME_SAMPLES);
+                bench::keep(vad.detect_voice(frame));
+            }
+        });
+
+        processing::AudioGainController agc;
+        runner.run("agc_process", {}, 1.0, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                frame.assign(frame_at(signal, i), frame_at(signal, i) + FRAME_SAMPLES);
+                agc.process(frame);
+                bench::keep(frame);
+            }
+        });
+
+        // Saat kayması telafisi: oynatma yolundaki kesirli yeniden örnekleme
+        processing::FractionalResampler resampler;
+        resampler.set_ratio(1.0005);
+        std::vector<int16_t> resampled(processing::FractionalResampler::max_output(FRAME_SAMPLES));
+        runner.run("resampler_process", {{"ratio", "1.0005"}}, 1.0, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                bench::keep(resampler.process(frame_at(signal, i), FRAME_SAMPLES, resampled.data()));
+                bench::keep(resampled);
+            }
+        });
+
+        // Gecikme denetimi: periyot araması + çapraz geçiş (en kötü durum: her blokta)
+        for (auto mode : {processing::TimeScaleModifier::Mode::Accelerate, processing::TimeScaleModifier::Mode::Expand}) {
+            processing::TimeScaleModifier time_scaler;
+            std::vector<int16_t> scaled(processing::TimeScaleModifier::max_output(FRAME_SAMPLES));
+            const char* mode_name = mode == processing::TimeScaleModifier::Mode::Accelerate ? "accelerate" : "expand";
+            runner.run("time_scale_process", {{"mode", mode_name}}, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) {
+                    bench::keep(time_scaler.process(frame_at(signal, i), FRAME_SAMPLES, mode, scaled.data()));
+                    bench::keep(scaled);
+                }
+            });
+        }
+
+        processing::AudioFrame audio_frame(FRAME_SAMPLES);
+        runner.run("audio_frame_features", {}, 1.0, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                audio_frame.assign(frame_at(signal, i), FRAME_SAMPLES);
+                bench::keep(audio_frame.rms());
+                bench::keep(audio_frame.peak());
+                bench::keep(audio_frame.zero_crossing_rate());
+            }
+        });
+
+        // Tam yakalama zinciri (EC -> NS -> VAD -> AGC): ayrı işleyiciler vs. CapturePipeline (aynı blok aşamaları, derleme zamanı zinciri)
+        {
+            processing::EchoCanceller canceller;
+            processing::NoiseSuppressor suppressor(processing::NoiseSuppressor::Engine::Spectral);
+            processing::VoiceActivityDetector chain_vad;
+            processing::AudioGainController chain_agc;
+            runner.run("capture_chain", {{"impl", "separate"}}, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) {
+                    canceller.on_playback(frame_at(far_signal, i), FRAME_SAMPLES);
+                    audio_frame.assign(frame_at(signal, i), FRAME_SAMPLES);
+                    canceller.process(audio_frame);
+                    suppressor.process(audio_frame);
+                    bench::keep(chain_vad.detect_voice(audio_frame));
+                    chain_agc.process(audio_frame);
+                    bench::keep(audio_frame.data()[0]);
+                }
+            });
+        }
+        {
+            processing::CapturePipeline pipeline;
+            runner.run("capture_chain", {{"impl", "pipeline"}}, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) {
+                    pipeline.stage<processing::EchoCancellerStage>().on_playback(frame_at(far_signal, i), FRAME_SAMPLES);
+                    audio_frame.assign(frame_at(signal, i), FRAME_SAMPLES);
+                    bench::keep(pipeline.process(audio_frame));
+                    bench::keep(audio_frame.data()[0]);
+                }
+            });
+        }
+
+        for (size_t size : {256u, 1024u}) {
+            processing::RealFft fft(size);
+            std::vector<float> input(size), re(size / 2 + 1), im(size / 2 + 1);
+            for (size_t i = 0; i < size; ++i) { input[i] = static_cast<float>(signal[i]); }
+            runner.run("fft_forward_inverse", {{"size", std::to_string(size)}}, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) {
+                    fft.forward(input.data(), re.data(), im.data());
+                    fft.inverse(re.data(), im.data(), input.data());
+                    bench::keep(input);
+                }
+            });
+        }
+    }
+
+    void bench_kernels(bench::Runner& runner, const std::vector<int16_t>& signal) {
+        std::vector<int16_t> frame(FRAME_SAMPLES);
+        for (auto level : {processing::SimdLevel::Scalar, processing::SimdLevel::Sse2, processing::SimdLevel::Avx2}) {
+            // Desteklenmeyen seviye alttakine düşer; aynı sonucu iki kez raporlamamak için atla
+            if (static_cast<int>(level) > static_cast<int>(processing::dsp_simd_level())) { continue; }
+            const auto& kernels = processing::dsp_kernels(level);
+            const bench::Params params = {{"simd", processing::dsp_simd_level_name(level)}};
+
+            runner.run("kernel_sum_of_squares", params, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) { bench::keep(kernels.sum_of_squares(frame_at(signal, i), FRAME_SAMPLES)); }
+            });
+            runner.run("kernel_zero_crossings", params, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) { bench::keep(kernels.zero_crossings(frame_at(signal, i), FRAME_SAMPLES)); }
+            });
+            runner.run("kernel_dot_product", params, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) { bench::keep(kernels.dot_product(frame_at(signal, i), frame_at(signal, i + 1), FRAME_SAMPLES)); }
+            });
+            runner.run("kernel_apply_gain", params, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) {
+                    kernels.apply_gain(frame.data(), frame.size(), (i & 1) ? 1.01f : 0.99f);
+                    bench::keep(frame);
+                }
+            });
+            runner.run("kernel_apply_gain_ramp", params, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) {
+                    std::copy(frame_at(signal, i), frame_at(signal, i) + FRAME_SAMPLES, frame.begin());
+                    kernels.apply_gain_ramp(frame.data(), frame.size(), 0.9f, 0.4f / FRAME_SAMPLES);
+                    bench::keep(frame);
+                }
+            });
+            runner.run("kernel_mix_saturate", params, 1.0, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; ++i) {
+                    kernels.mix_saturate(frame.data(), frame_at(signal, i), FRAME_SAMPLES);
+                    bench::keep(frame);
+                }
+            });
+        }
+    }
+
+    // Aygıt açılmadan: üretici submit, tüketici render (callback'in yaptığı iş)
+    void bench_player(bench::Runner& runner, const std::vector<int16_t>& signal) {
+        playback::AudioPlayer player;
+        std::vector<int16_t> output(FRAME_SAMPLES);
+        runner.run("player_submit_render", {{"frame", std::to_string(FRAME_SAMPLES)}}, 1.0, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                player.submit_audio_data(frame_at(signal, i), FRAME_SAMPLES);
+                player.render(output.data(), FRAME_SAMPLES);
+                bench::keep(output);
+            }
+        });
+    }
+
+    // Üretimde açık kalan ölçüm maliyeti: iki steady_clock okuması + histogram kaydı
+    void bench_metrics(bench::Runner& runner) {
+        core::LatencyHistogram histogram;
+        runner.run("latency_histogram_record", {}, 1.0, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                auto start = std::chrono::steady_clock::now();
+                histogram.record(std::chrono::steady_clock::now() - start);
+            }
+        });
+        bench::keep(histogram.snapshot().count);
+    }
+
+    void print_usage(const char* program) {
+        std::cerr << "Kullanim: " << program << " [--json dosya.json] [--filter metin] [--min-time ms] [--repetitions n] [--list]" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    bench::Runner runner;
+    std::string json_path;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) { json_path = argv[++i]; }
+        else if (arg == "--filter" && i + 1 < argc) { runner.filter = argv[++i]; }
+        else if (arg == "--min-time" && i + 1 < argc) { runner.min_time = std::chrono::milliseconds(std::stoi(argv[++i])); }
+        else if (arg == "--repetitions" && i + 1 < argc) { runner.repetitions = std::stoi(argv[++i]); }
+        else if (arg == "--list") { runner.list_only = true; }
+        else { print_usage(argv[0]); return 1; }
+    }
+
+    try {
+        const std::vector<int16_t> signal = make_signal(SIGNAL_FRAMES, 1);
+        const std::vector<int16_t> far_signal = make_signal(SIGNAL_FRAMES, 2, 4000.0f);
+
+        bench_codec(runner, signal);
+        bench_packets(runner);
+        bench_collector(runner);
+        bench_processing(runner, signal, far_signal);
+        bench_kernels(runner, signal);
+        bench_player(runner, signal);
+        bench_metrics(runner);
+
+        if (!json_path.empty() && !runner.list_only) {
+            if (!runner.write_json(json_path, VOICE_ENGINE_VERSION, processing::dsp_simd_level_name(processing::dsp_simd_level()))) {
+                return 1;
+            }
+            std::cout << ">>> JSON sonuçları yazıldı: " << json_path << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Bench hatayla sonlandirildi: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -2,42 +2,107 @@
 #define VOICE_ENGINE_APPLICATION_HPP
 
 #include "core/non_copyable.hpp"
+#include "app/engine_metrics.hpp"
 #include "capture/audio_capturer.hpp"
 #include "codec/opus_codec.hpp"
 #include "streaming/slicer.hpp"
 #include "streaming/collector.hpp"
+#include "streaming/feedback.hpp"
+#include "streaming/frame_accumulator.hpp"
+#include "network/event_loop.hpp"
 #include "network/udp_sender.hpp"
 #include "network/udp_receiver.hpp"
+#include "network/stats_endpoint.hpp"
 #include "playback/audio_player.hpp"
-#include "processing/echo_canceller.hpp"
-#include "processing/noise_suppressor.hpp"
-#include "processing/voice_activity_detector.hpp"
+#include "processing/audio_frame.hpp"
+#include "processing/capture_pipeline.hpp"
 #include <string>
 #include <memory>
 #include <vector>
+#include <chrono>
 #include <cstdint>
 
 namespace app {
     class Application : private core::NonCopyable {
     public:
+        // Yakalama/oynatma aygıt çerçevesi (10ms); paketleme süresi bundan bağımsızdır
+        static constexpr size_t FRAME_SAMPLES = capture::AudioCapturer::FRAMES_PER_BUFFER * capture::AudioCapturer::NUM_CHANNELS;
+        // Sessizlik sürerken SID tekrarı (RTP timestamp birimi, 400ms)
+        static constexpr uint32_t SID_INTERVAL = capture::AudioCapturer::SAMPLE_RATE * 2 / 5;
+        // Jitter buffer deadline kontrolü: paket gelmese de kayıplar zamanında gizlenir
+        static constexpr std::chrono::milliseconds JITTER_POLL_INTERVAL{5};
+        // Yakalama zinciri (çevrimdışı hat ve ölçümlerle ortak tip)
+        using CapturePipeline = processing::CapturePipeline;
+        static_assert(CapturePipeline::FRAME_SAMPLES == capture::AudioCapturer::FRAMES_PER_BUFFER &&
+                      CapturePipeline::CHANNELS == capture::AudioCapturer::NUM_CHANNELS,
+                      "Yakalama zinciri aygıt çerçevesiyle aynı boyutta olmalı");
+
+        struct Config {
+            int ptime_ms = 10;   // Opus paket süresi: 10, 20, 40 veya 60 ms
+            bool dtx = true;     // Sessizlikte seyrek SID (konfor gürültüsü seviyesi) gönder
+            network::IoBackend io_backend = network::IoBackend::Auto;
+            // network: olay döngüsü (alım, decode, oynatmaya besleme), processing: yakalama worker'ı
+            // (EC/NS/VAD, encode, gönderim)
+            core::RealtimeConfig realtime;
+            bool playout_agc = false;   // Alınan sesi de oynatmadan önce AGC + sınırlayıcıdan geçir
+        };
+
         Application();
+        explicit Application(const Config& config);
         ~Application();
+        // run'dan önce çağrılır; aşama histogramları ve sayaçlar soket/dosya ile dışa açılır.
+        void enable_stats(const network::StatsEndpoint::Config& config);
         void run(const std::string& target_ip, int send_port, int listen_port);
+        std::string stats_json() const;
     private:
         void on_audio_captured(const std::vector<int16_t>& pcm_data);
-        void on_packet_received(core::Packet packet);
+        void on_datagram_received(const uint8_t* data, size_t size);
         void on_audio_collected(const std::vector<uint8_t>& encoded_data);
+        void on_audio_lost(const std::vector<uint8_t>& next_data);
+        void play_decoded(size_t decoded_samples);
+        void on_feedback_received(const core::PacketView& packet);
+        void send_feedback();
+        void send_silence_descriptor(uint32_t timestamp);
+        void on_silence(const std::vector<uint8_t>& sid_payload);
 
+        const Config config_;
+        // Alım, geri bildirim ve jitter buffer zamanlayıcıları tek döngüde (receive thread).
+        // Soketler döngüden sonra yıkılsın diye ilk üye.
+        std::unique_ptr<network::EventLoop>     event_loop_;
+        // Oynatma callback'i yankı gidericiye yazar; oynatıcıdan sonra yıkılsın diye onun önünde
+        CapturePipeline capture_pipeline_;
         std::unique_ptr<capture::AudioCapturer> capturer_;
         std::unique_ptr<codec::OpusCodec>       codec_;
         std::unique_ptr<streaming::Slicer>      slicer_;
         std::unique_ptr<network::UdpSender>     sender_;
+        std::unique_ptr<network::UdpSender>     feedback_sender_;  // Döngü thread'inin kendi soketi
         std::unique_ptr<network::UdpReceiver>   receiver_;
         std::unique_ptr<streaming::Collector>   collector_;
         std::unique_ptr<playback::AudioPlayer>  player_;
-        std::unique_ptr<processing::EchoCanceller> echo_canceller_;
-        std::unique_ptr<processing::NoiseSuppressor> noise_suppressor_;
-        std::unique_ptr<processing::VoiceActivityDetector> vad_;
+        std::unique_ptr<processing::AudioGainController> playout_agc_;   // Yalnızca playout_agc açıksa
+        std::unique_ptr<network::StatsEndpoint> stats_endpoint_;
+
+        EngineMetrics metrics_;
+
+        // Sıcak yol için önceden ayrılmış tamponlar (capture thread / receive thread)
+        processing::AudioFrame capture_frame_;  // Aşamalar arasında özellik önbelleğiyle dolaşır
+        streaming::FrameAccumulator accumulator_; // 10ms çerçeveleri ptime kadar biriktirir
+        std::vector<uint8_t> encode_buffer_;
+        std::vector<int16_t> decode_buffer_;
+        std::vector<core::PacketView> outgoing_packets_;
+        streaming::Collector::OnDataCollected on_collected_;
+
+        // Geri bildirim döngüsü (döngü thread'i): raporlar karşıya gider, gelen raporlar encoder'ı ayarlar
+        streaming::FeedbackReporter feedback_reporter_;
+        streaming::RateController rate_controller_;
+        std::vector<uint8_t> feedback_buffer_;
+        uint16_t feedback_sequence_ = 0;
+
+        // RTP medya saati: gönderilmeyen (VAD) çerçevelerde de ilerler
+        uint32_t capture_timestamp_ = 0;
+        bool was_voice_active_ = false;
+        bool sid_sent_ = false;              // Bu sessizlik döneminde en az bir SID gitti
+        uint32_t last_sid_timestamp_ = 0;
     };
 }
 
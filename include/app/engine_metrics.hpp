@@ -0,0 +1,66 @@
+#ifndef VOICE_ENGINE_ENGINE_METRICS_HPP
+#define VOICE_ENGINE_ENGINE_METRICS_HPP
+
+#include "core/non_copyable.hpp"
+#include "core/latency_histogram.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <cstdint>
+
+namespace app {
+    // Görüşme hattının aşama gecikmeleri ve olay sayaçları. Kayıt yolları kilitsizdir
+    // (relaxed atomikler), üretimde açık bırakılabilir; snapshot JSON olarak okunur.
+    class EngineMetrics : private core::NonCopyable {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        enum Stage {
+            CAPTURE_QUEUE,     // Yakalama callback'i -> işleme başlangıcı (worker kuyruğu)
+            PROCESS,           // EC + NS + VAD
+            ENCODE,
+            SEND,              // Slicer + soket gönderimi
+            CAPTURE_TO_SEND,   // Yakalama callback'i -> gönderim bitişi
+            RECEIVE,           // Datagram çözümü + Collector (decode ve submit dahil)
+            DECODE,            // Normal decode ve PLC/FEC
+            PLAYOUT_BUFFER,    // Submit edilen çerçevenin önündeki oynatma tamponu (süre olarak)
+            STAGE_COUNT
+        };
+
+        enum Counter {
+            PACKETS_SENT,
+            PACKETS_RECEIVED,
+            PACKETS_REJECTED,  // Çözülemeyen veya Opus olmayan datagramlar
+            VAD_DROPPED,       // Sessiz olduğu için gönderilmeyen çerçeveler
+            ENCODE_FAILURES,
+            DECODE_FAILURES,
+            FEEDBACK_SENT,     // Karşıya gönderilen alıcı raporları
+            FEEDBACK_RECEIVED, // Encoder ayarına giren raporlar
+            SID_SENT,          // DTX: sessizlikte gönderilen konfor gürültüsü paketleri
+            SID_RECEIVED,
+            COUNTER_COUNT
+        };
+
+        static const char* stage_name(Stage stage);
+        static const char* counter_name(Counter counter);
+
+        void record(Stage stage, Clock::duration elapsed) { stages_[stage].record(elapsed); }
+        void add(Counter counter, uint64_t amount = 1) {
+            counters_[counter].fetch_add(amount, std::memory_order_relaxed);
+        }
+        uint64_t counter(Counter counter) const { return counters_[counter].load(std::memory_order_relaxed); }
+        core::LatencyHistogram::Snapshot snapshot(Stage stage) const { return stages_[stage].snapshot(); }
+
+        // "stages_ns":{...},"counters":{...} alanları; dış JSON nesnesine gömülmek üzere süslü parantezsiz
+        std::string to_json_fields() const;
+        // {"count":..,"mean":..,"p50":..,...,"max":..} (ns)
+        static std::string histogram_json(const core::LatencyHistogram::Snapshot& snapshot);
+
+    private:
+        std::array<core::LatencyHistogram, STAGE_COUNT> stages_;
+        std::array<std::atomic<uint64_t>, COUNTER_COUNT> counters_{};
+    };
+}
+
+#endif
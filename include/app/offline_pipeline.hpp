@@ -0,0 +1,86 @@
+#ifndef VOICE_ENGINE_OFFLINE_PIPELINE_HPP
+#define VOICE_ENGINE_OFFLINE_PIPELINE_HPP
+
+#include "core/non_copyable.hpp"
+#include "core/packet.hpp"
+#include "codec/opus_codec.hpp"
+#include "streaming/slicer.hpp"
+#include "streaming/collector.hpp"
+#include "streaming/frame_accumulator.hpp"
+#include "processing/audio_frame.hpp"
+#include "processing/capture_pipeline.hpp"
+#include <array>
+#include <vector>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+namespace app {
+    // Ses aygıtı ve soket olmadan Application ile aynı zinciri çalıştırır:
+    // gönderim (processing::CapturePipeline: EC -> NS -> VAD -> AGC, encode -> Slicer + RTP serialize)
+    // ve alım (RTP parse -> Collector -> decode). DSP geçişleri 10ms çerçeve başına (Pipeline'ın
+    // geçiş kancasıyla), encode ve sonrası paket (ptime) başına ölçülür. Birleştirilen örnek
+    // aşamaları tek geçiş olduğundan DSP süreleri aşamaya değil geçişin sıra numarasına göre tutulur.
+    class OfflinePipeline : private core::NonCopyable {
+    public:
+        static constexpr int SAMPLE_RATE = 48000;
+        static constexpr size_t FRAME_SAMPLES = processing::CapturePipeline::FRAME_SIZE; // 10ms mono
+
+        static constexpr size_t CAPTURE_PASSES = processing::CapturePipeline::pass_count();
+        // CapturePipeline'daki aşama indeksine göre ad
+        static const char* capture_stage_name(size_t stage);
+
+        // Yakalama zincirinden sonraki, paket başına ölçülen aşamalar
+        enum Stage { ENCODE, PACKETIZE, COLLECT, DECODE, STAGE_COUNT };
+        static const char* stage_name(Stage stage);
+
+        struct CapturePass {
+            size_t first_stage = 0;          // Geçiş kancasının verdiği ilk aşama indeksi
+            std::vector<uint32_t> ns;
+        };
+
+        struct Config {
+            int ptime_ms = 10;   // Opus paket süresi: 10, 20, 40 veya 60 ms
+        };
+
+        struct Result {
+            size_t frames = 0;
+            size_t frames_sent = 0;      // Gönderilen paketlerdeki 10ms çerçeveler
+            size_t packets_sent = 0;
+            size_t frames_decoded = 0;   // Decode edilen paketler
+            std::array<CapturePass, CAPTURE_PASSES> capture_passes;  // Geçiş sırasıyla
+            std::array<std::vector<uint32_t>, STAGE_COUNT> stage_ns; // Yalnızca çalışan aşamalar
+            std::vector<uint32_t> frame_ns;                          // Çerçeve başına toplam
+            std::vector<int16_t> output;                             // keep_output ise
+            processing::AudioGainController::Stats agc;              // Koşu sonundaki AGC/sınırlayıcı durumu
+            size_t capture_latency_samples = 0;                      // Sınırlayıcının ileri bakış gecikmesi
+        };
+
+        // Geçişin kapsadığı aşama adları '+' ile birleştirilir (birleştirilmiş grup için birden çok)
+        static std::string capture_pass_name(const Result& result, size_t pass);
+
+        OfflinePipeline();
+        explicit OfflinePipeline(const Config& config);
+
+        // far_end boş değilse her çerçeveden önce yankı gidericiye oynatma referansı olarak verilir.
+        Result run(const std::vector<int16_t>& input, const std::vector<int16_t>& far_end, bool keep_output);
+
+    private:
+        processing::CapturePipeline capture_pipeline_;
+        std::unique_ptr<codec::OpusCodec> encoder_;
+        std::unique_ptr<codec::OpusCodec> decoder_;
+        std::unique_ptr<streaming::Slicer> slicer_;
+        std::unique_ptr<streaming::Collector> collector_;
+
+        const Config config_;
+        processing::AudioFrame frame_;
+        streaming::FrameAccumulator accumulator_;
+        std::vector<uint8_t> encode_buffer_;
+        std::vector<uint8_t> datagram_buffer_;
+        std::vector<int16_t> decode_buffer_;
+        std::vector<core::PacketView> outgoing_packets_;
+    };
+}
+
+#endif
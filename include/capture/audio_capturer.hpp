@@ -2,11 +2,22 @@
 #define VOICE_ENGINE_AUDIO_CAPTURER_HPP
 
 #include "core/non_copyable.hpp"
+#include "core/spsc_ring_buffer.hpp"
+#include "core/latency_histogram.hpp"
+#include "core/realtime.hpp"
 
 #include <portaudio.h>
 #include <vector>
+#include <array>
 #include <functional>
 #include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
 
 namespace capture {
     class AudioCapturer : private core::NonCopyable {
@@ -17,18 +28,95 @@ namespace capture {
         static constexpr PaSampleFormat FORMAT = paInt16;
         static constexpr int FRAMES_PER_BUFFER = 480;
 
+        enum class CaptureMode {
+            Direct,    // Kullanıcı callback'i doğrudan PortAudio callback'inden çağrılır
+            Pipelined  // Callback sadece kopyalar; işleme/encode/gönderme worker thread'de
+        };
+
+        enum class OverflowPolicy {
+            DropNewest, // Kuyruk doluysa yeni çerçeve atılır
+            // En yeni çerçeve her zaman tutulur, derinliği aşan en eski çerçeveler atılır: callback
+            // yedek kapasiteli kuyruğa yazar, worker çıkarırken kuyruğu queue_depth'e kırpar. Worker
+            // yedek kapasiteyi de dolduracak kadar takılırsa yeni çerçeve taşma yuvasına yazılır ve
+            // kuyruktakilerden sonra işlenir (yuvadaki daha eski çerçevenin üzerine yazılır).
+            DropOldest
+        };
+
+        struct PipelineConfig {
+            CaptureMode mode = CaptureMode::Pipelined;
+            size_t queue_depth = 8; // 10ms çerçeve cinsinden
+            OverflowPolicy overflow_policy = OverflowPolicy::DropOldest;
+        };
+
+        struct PipelineStats {
+            uint64_t frames_captured = 0;
+            uint64_t frames_processed = 0;
+            uint64_t frames_dropped = 0;   // Kuyruk taşması nedeniyle atılan çerçeveler
+            uint64_t input_overflows = 0;  // PortAudio paInputOverflow bildirimleri
+            uint64_t avg_latency_ns = 0;   // Callback -> kullanıcı callback'i dönüşü (gönderim dahil)
+            uint64_t max_latency_ns = 0;
+            size_t queue_size = 0;
+            core::SchedPolicy worker_policy = core::SchedPolicy::Default;   // Worker'da fiilen uygulanan
+        };
+
         AudioCapturer();
+        explicit AudioCapturer(const PipelineConfig& config);
         ~AudioCapturer();
         bool start(AudioCallback callback);
         void stop();
         bool is_capturing() const;
+        PipelineStats get_stats() const;
+        // Pipelined modda start'tan önce: worker thread'inin zamanlama sınıfı ve CPU kümesi.
+        // PortAudio callback thread'i aygıt sürücüsünce zaten gerçek zamanlıdır, dokunulmaz.
+        void set_thread_tuning(const core::ThreadTuning& tuning) { tuning_ = tuning; }
+        // Worker uyanma gecikmesi: boşta beklerken gelen çerçevenin kuyruğa girişi -> worker'ın alması
+        core::LatencyHistogram::Snapshot wakeup_lateness() const { return wakeup_lateness_.snapshot(); }
+        // İşlenmekte olan çerçevenin yakalama callback'ine girdiği an.
+        // Yalnızca kullanıcı callback'i içinden çağrılmalıdır (aynı thread).
+        std::chrono::steady_clock::time_point frame_timestamp() const { return current_frame_timestamp_; }
     private:
+        struct CapturedFrame {
+            std::array<int16_t, FRAMES_PER_BUFFER * NUM_CHANNELS> samples;
+            size_t sample_count;
+            std::chrono::steady_clock::time_point timestamp;
+        };
+
         static int pa_callback(const void*, void*, unsigned long, const PaStreamCallbackTimeInfo*, PaStreamCallbackFlags, void*);
-        int process(const int16_t*, unsigned long);
+        int process(const int16_t*, unsigned long, PaStreamCallbackFlags);
+        void enqueue(const int16_t*, size_t);
+        void store_overflow(const int16_t*, size_t);
+        bool take_overflow(CapturedFrame& frame);
+        void worker_loop();
+        void record_latency(std::chrono::steady_clock::time_point captured_at);
+
         PaStream *stream_ = nullptr;
         AudioCallback user_callback_;
         bool is_capturing_ = false;
+
+        const PipelineConfig config_;
+        std::unique_ptr<core::SpscRingBuffer<CapturedFrame>> queue_;
+        std::vector<int16_t> worker_frame_;
+        std::chrono::steady_clock::time_point current_frame_timestamp_{};
+        std::thread worker_thread_;
+        std::atomic<bool> worker_running_{false};
+        // DropOldest taşma yuvası: kuyruk tamamen doluyken gelen en yeni çerçeve. Doluyken callback
+        // kuyruğa yazmaz (sıra korunur); kilit yalnızca kopyalama süresince tutulur, callback beklemez.
+        CapturedFrame overflow_frame_{};
+        std::atomic<bool> overflow_pending_{false};
+        std::atomic_flag overflow_lock_ = ATOMIC_FLAG_INIT;
+        std::mutex worker_mutex_;
+        std::condition_variable worker_cv_;
+        core::ThreadTuning tuning_;
+        std::atomic<core::SchedPolicy> worker_policy_{core::SchedPolicy::Default};
+        core::LatencyHistogram wakeup_lateness_;
+
+        std::atomic<uint64_t> frames_captured_{0};
+        std::atomic<uint64_t> frames_processed_{0};
+        std::atomic<uint64_t> frames_dropped_{0};
+        std::atomic<uint64_t> input_overflows_{0};
+        std::atomic<uint64_t> latency_sum_ns_{0};
+        std::atomic<uint64_t> max_latency_ns_{0};
     };
 }
 
-#endif
\ No newline at end of file
+#endif
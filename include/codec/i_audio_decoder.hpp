@@ -3,13 +3,16 @@
 
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 
 namespace codec {
     class IAudioDecoder {
     public:
         virtual ~IAudioDecoder() = default;
+        // Allocation yapmayan sıcak yol: çağıranın tamponuna yazar, yazılan sample sayısını döner (hata: 0).
+        virtual size_t decode(const uint8_t* encoded_data, size_t size, int16_t* out, size_t out_capacity) = 0;
         virtual std::vector<int16_t> decode(const std::vector<uint8_t>& encoded_data) = 0;
     };
 }
 
-#endif
\ No newline at end of file
+#endif
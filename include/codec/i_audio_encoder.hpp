@@ -3,13 +3,16 @@
 
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 
 namespace codec {
     class IAudioEncoder {
     public:
         virtual ~IAudioEncoder() = default;
+        // Allocation yapmayan sıcak yol: çağıranın tamponuna yazar, yazılan byte sayısını döner (hata: 0).
+        virtual size_t encode(const int16_t* pcm_data, size_t sample_count, uint8_t* out, size_t out_capacity) = 0;
         virtual std::vector<uint8_t> encode(const std::vector<int16_t>& pcm_data) = 0;
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -6,20 +6,70 @@
 #include "core/non_copyable.hpp"
 #include <opus/opus.h>
 #include <vector>
+#include <atomic>
+#include <mutex>
+#include <cstddef>
 
 namespace codec {
+    // Çalışırken değiştirilebilen encoder ayarları
+    struct EncoderSettings {
+        int bitrate = 64000;              // bit/s
+        int complexity = 5;               // 0..10
+        bool inband_fec = true;
+        int expected_loss_percent = 5;    // OPUS_SET_PACKET_LOSS_PERC: FEC'e ayrılan bant
+    };
+
     class OpusCodec : public IAudioEncoder, public IAudioDecoder, private core::NonCopyable {
     public:
-        OpusCodec(int sample_rate = 48000, int channels = 1);
+        static constexpr size_t MAX_PACKET_SIZE = 4000; // Max Opus packet size
+        static constexpr int MAX_FRAME_MULTIPLIER = 6;  // 10ms x 6 = 60ms (Opus tek çerçeve üst sınırı)
+
+        // frame_duration_ms: encode edilen çerçeve (paketleme) süresi; 10, 20, 40 veya 60.
+        // Decoder gelen paketin süresini kendisi okur, bu ayardan bağımsızdır.
+        OpusCodec(int sample_rate = 48000, int channels = 1, int frame_duration_ms = 10);
         ~OpusCodec();
+
+        size_t encode(const int16_t* pcm_data, size_t sample_count, uint8_t* out, size_t out_capacity) override;
+        size_t decode(const uint8_t* encoded_data, size_t size, int16_t* out, size_t out_capacity) override;
+        // Kayıp çerçeve gizleme: next_data doluysa in-band FEC, boşsa PLC kullanılır.
+        size_t decode_lost(const uint8_t* next_data, size_t next_size, int16_t* out, size_t out_capacity);
+
+        // Vector API: yukarıdaki çağrıların ince sarmalayıcıları
         std::vector<uint8_t> encode(const std::vector<int16_t>& pcm_data) override;
         std::vector<int16_t> decode(const std::vector<uint8_t>& encoded_data) override;
+        std::vector<int16_t> decode_lost(const std::vector<uint8_t>& next_data);
+
+        // Thread-safe encoder kontrolü: herhangi bir thread'den çağrılabilir. Ayarlar bir
+        // sonraki encode() başında encode thread'inde topluca uygulanır (yarım ayar görülmez).
+        // Geçersiz değerler reddedilir (false), kabul edilenlerde true döner.
+        bool set_bitrate(int bits_per_second);
+        bool set_complexity(int complexity);
+        bool apply_settings(const EncoderSettings& settings);
+        // Son istenen ayarlar (henüz uygulanmamış olabilir)
+        EncoderSettings settings() const;
+
+        static bool is_valid_frame_duration(int frame_duration_ms) {
+            return frame_duration_ms == 10 || frame_duration_ms == 20 || frame_duration_ms == 40 || frame_duration_ms == 60;
+        }
+        // encode()'un beklediği kanal başına sample sayısı
+        int frame_size() const { return frame_size_; }
+
+        // Decode tamponu için gereken en fazla sample sayısı (60ms paket)
+        size_t max_decoded_samples() const { return static_cast<size_t>(sample_rate_ / 100 * channels_ * MAX_FRAME_MULTIPLIER); }
     private:
+        static bool is_valid(const EncoderSettings& settings);
+        void apply_pending_settings();
+
         OpusEncoder* encoder_;
         OpusDecoder* decoder_;
         const int sample_rate_;
         const int channels_;
         const int frame_size_;
+
+        mutable std::mutex settings_mutex_;
+        EncoderSettings requested_settings_;
+        // Encode sıcak yolunda yalnızca bu bayrak okunur; kilit sadece ayar değiştiğinde alınır
+        std::atomic<bool> settings_pending_{false};
     };
 }
 
@@ -0,0 +1,115 @@
+#ifndef VOICE_ENGINE_MIXER_SERVER_HPP
+#define VOICE_ENGINE_MIXER_SERVER_HPP
+
+#include "core/non_copyable.hpp"
+#include "core/packet.hpp"
+#include "core/realtime.hpp"
+#include "core/thread_pool.hpp"
+#include "codec/opus_codec.hpp"
+#include "network/event_loop.hpp"
+#include "network/udp_receiver.hpp"
+#include "network/udp_sender.hpp"
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+namespace conference {
+    // Ses aygıtı kullanmayan (PortAudio'suz) çok katılımcılı konferans mikseri.
+    // Tek UDP portundan gelen akışlar SSRC ile ayrıştırılır; her katılımcı kendi jitter buffer'ı
+    // ve decoder durumuna sahiptir. Her 10ms'de katılımcılara kendileri hariç herkesin karışımı
+    // (mix-minus) gönderilir. O tick'te ses katkısı olmayan katılımcıların karışımı aynıdır,
+    // bu yüzden onlar için bir kez encode edilip hepsine gönderilir. Konuşan katılımcı kendi
+    // encoder'ına geçer; sustuktan sonra kısa bir hangover boyunca aynı encoder'la tam karışımı
+    // encode edip ortak akışa döner, böylece tick başına encode ≈ konuşan sayısı + 1 kalır.
+    // Decode/encode işleri thread pool'da koşar.
+    // Alım, jitter buffer deadline'ları ve 10ms mix tick'i tek olay döngüsünde (EventLoop) çalışır.
+    class MixerServer : private core::NonCopyable {
+    public:
+        static constexpr int SAMPLE_RATE = 48000;
+        static constexpr int FRAME_SAMPLES = SAMPLE_RATE / 100; // 10ms mono
+
+        struct Config {
+            int port = 9000;
+            int reply_port = 0;             // 0: kaynak porta cevap ver, aksi halde kaynak IP + bu port
+            size_t worker_threads = 0;      // 0: çekirdek sayısı
+            size_t max_participants = 256;
+            std::chrono::milliseconds participant_timeout{10000};
+            network::IoBackend io_backend = network::IoBackend::Auto;
+            // network: olay döngüsü (alım + mix tick'i), processing: decode/encode worker'ları
+            core::RealtimeConfig realtime;
+        };
+
+        struct Stats {
+            size_t participants = 0;
+            uint64_t ticks = 0;
+            uint64_t frames_decoded = 0;
+            uint64_t frames_concealed = 0;
+            uint64_t mixes_encoded = 0;    // Farklı karışım başına encode sayısı
+            uint64_t speakers_mixed = 0;   // Tick'lerde karışıma katkı veren katılımcıların toplamı
+            uint64_t max_tick_encodes = 0; // Tek tick'teki en yüksek encode sayısı
+            uint64_t packets_sent = 0;
+            uint64_t rejected_joins = 0;
+            uint64_t avg_tick_ns = 0;
+            uint64_t max_tick_ns = 0;
+            core::SchedPolicy loop_policy = core::SchedPolicy::Default;
+            uint64_t tick_lateness_p99_ns = 0;   // Mix tick'inin deadline'a göre uyanma gecikmesi
+            uint64_t tick_lateness_max_ns = 0;
+        };
+
+        explicit MixerServer(const Config& config);
+        ~MixerServer();
+
+        bool start();
+        void stop();
+        Stats get_stats() const;
+
+    private:
+        struct Participant;
+
+        void on_datagram(const uint8_t* data, size_t size, const sockaddr_in& source);
+        std::shared_ptr<Participant> find_or_add(uint32_t ssrc, const sockaddr_in& source);
+        void on_tick();
+        void mix_tick();
+
+        const Config config_;
+        network::EventLoop loop_;            // Soketlerden önce kurulur, sonra yıkılır
+        network::UdpReceiver receiver_;
+        network::UdpSender sender_;
+        core::ThreadPool pool_;
+
+        mutable std::mutex participants_mutex_;
+        std::unordered_map<uint32_t, std::shared_ptr<Participant>> participants_;
+
+        // Mix thread'ine ait, tick'ler arasında yeniden kullanılan tamponlar
+        std::vector<std::shared_ptr<Participant>> active_;
+        std::vector<int32_t> mix_sum_;
+        std::vector<int16_t> shared_mix_;
+        std::vector<uint8_t> shared_encoded_;
+        size_t shared_encoded_size_ = 0;
+        std::unique_ptr<codec::OpusCodec> shared_codec_;
+        std::vector<core::PacketView> outgoing_packets_;
+        std::vector<sockaddr_in> outgoing_destinations_;
+
+        network::EventLoop::TimerId tick_timer_ = 0;
+        std::atomic<bool> is_running_{false};
+
+        std::atomic<uint64_t> ticks_{0};
+        std::atomic<uint64_t> frames_decoded_{0};
+        std::atomic<uint64_t> frames_concealed_{0};
+        std::atomic<uint64_t> mixes_encoded_{0};
+        std::atomic<uint64_t> speakers_mixed_{0};
+        std::atomic<uint64_t> max_tick_encodes_{0};
+        std::atomic<uint64_t> packets_sent_{0};
+        std::atomic<uint64_t> rejected_joins_{0};
+        std::atomic<uint64_t> tick_time_sum_ns_{0};
+        std::atomic<uint64_t> max_tick_ns_{0};
+    };
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef VOICE_ENGINE_ALIGNED_BUFFER_HPP
+#define VOICE_ENGINE_ALIGNED_BUFFER_HPP
+
+#include <cstddef>
+#include <new>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+namespace core {
+    // SIMD yükleri için hizalı, sabit boyutlu, sıfırla başlatılmış dizi.
+    // Boyut yalnızca oluşturulurken belirlenir; sıcak yolda allocation yapılmaz.
+    template <typename T, size_t Alignment = 64>
+    class AlignedBuffer {
+        static_assert(std::is_trivial<T>::value, "AlignedBuffer yalnızca trivial tipler içindir");
+    public:
+        AlignedBuffer() = default;
+        explicit AlignedBuffer(size_t size) : size_(size) {
+            if (size_ > 0) {
+                data_ = static_cast<T*>(::operator new(size_ * sizeof(T), std::align_val_t(Alignment)));
+                std::fill(data_, data_ + size_, T{});
+            }
+        }
+        ~AlignedBuffer() { release(); }
+
+        AlignedBuffer(const AlignedBuffer&) = delete;
+        AlignedBuffer& operator=(const AlignedBuffer&) = delete;
+        AlignedBuffer(AlignedBuffer&& other) noexcept
+            : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+        AlignedBuffer& operator=(AlignedBuffer&& other) noexcept {
+            if (this != &other) {
+                release();
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        T* data() { return data_; }
+        const T* data() const { return data_; }
+        size_t size() const { return size_; }
+        T& operator[](size_t i) { return data_[i]; }
+        const T& operator[](size_t i) const { return data_[i]; }
+        T* begin() { return data_; }
+        T* end() { return data_ + size_; }
+        void zero() { std::fill(data_, data_ + size_, T{}); }
+
+    private:
+        void release() {
+            if (data_) {
+                ::operator delete(data_, std::align_val_t(Alignment));
+                data_ = nullptr;
+            }
+        }
+
+        T* data_ = nullptr;
+        size_t size_ = 0;
+    };
+}
+
+#endif
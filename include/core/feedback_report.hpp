@@ -0,0 +1,61 @@
+#ifndef VOICE_ENGINE_FEEDBACK_REPORT_HPP
+#define VOICE_ENGINE_FEEDBACK_REPORT_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+namespace core {
+    // Alıcıdan göndericiye periyodik geri bildirim (RTCP RR rapor bloğunun sadeleştirilmiş hali).
+    // Aynı UDP yolundan PAYLOAD_TYPE_FEEDBACK ile RTP payload'ı olarak taşınır; RTP başlığındaki
+    // SSRC raporlayanın, media_ssrc raporlanan akışındır. Tüm alanlar network byte order:
+    //  media_ssrc (32) | fraction_lost (8) | cumulative_lost (24) | highest_sequence (32) | jitter (32)
+    struct FeedbackReport {
+        static constexpr size_t SERIALIZED_SIZE = 16;
+
+        uint32_t media_ssrc = 0;
+        uint8_t fraction_lost = 0;       // Son rapordan beri kayıp oranı, 1/256 birimi
+        uint32_t cumulative_lost = 0;    // 24 bit, doygun
+        uint32_t highest_sequence = 0;   // 32 bite genişletilmiş en yüksek sequence
+        uint32_t jitter = 0;             // Varış jitter'ı, RTP timestamp birimi
+
+        double loss_ratio() const { return fraction_lost / 256.0; }
+
+        size_t serialize(uint8_t* out, size_t capacity) const {
+            if (!out || capacity < SERIALIZED_SIZE) { return 0; }
+            write_u32(out, media_ssrc);
+            const uint32_t lost = cumulative_lost > 0xFFFFFF ? 0xFFFFFF : cumulative_lost;
+            write_u32(out + 4, (static_cast<uint32_t>(fraction_lost) << 24) | lost);
+            write_u32(out + 8, highest_sequence);
+            write_u32(out + 12, jitter);
+            return SERIALIZED_SIZE;
+        }
+
+        static bool parse(const uint8_t* bytes, size_t size, FeedbackReport& report) {
+            if (!bytes || size < SERIALIZED_SIZE) { return false; }
+            report.media_ssrc = read_u32(bytes);
+            const uint32_t loss_word = read_u32(bytes + 4);
+            report.fraction_lost = static_cast<uint8_t>(loss_word >> 24);
+            report.cumulative_lost = loss_word & 0xFFFFFF;
+            report.highest_sequence = read_u32(bytes + 8);
+            report.jitter = read_u32(bytes + 12);
+            return true;
+        }
+
+    private:
+        static void write_u32(uint8_t* out, uint32_t value) {
+            out[0] = static_cast<uint8_t>(value >> 24);
+            out[1] = static_cast<uint8_t>(value >> 16);
+            out[2] = static_cast<uint8_t>(value >> 8);
+            out[3] = static_cast<uint8_t>(value);
+        }
+
+        static uint32_t read_u32(const uint8_t* in) {
+            return (static_cast<uint32_t>(in[0]) << 24) |
+                   (static_cast<uint32_t>(in[1]) << 16) |
+                   (static_cast<uint32_t>(in[2]) << 8)  |
+                   (static_cast<uint32_t>(in[3]));
+        }
+    };
+}
+
+#endif
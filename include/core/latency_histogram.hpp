@@ -0,0 +1,73 @@
+#ifndef VOICE_ENGINE_LATENCY_HISTOGRAM_HPP
+#define VOICE_ENGINE_LATENCY_HISTOGRAM_HPP
+
+#include "core/non_copyable.hpp"
+#include <array>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+namespace core {
+    // HDR tarzı log-lineer histogram: her ikinin kuvveti aralığı SUB_BUCKETS eşit parçaya
+    // bölünür (göreli hata <= %6.25), 0..2^64 ns aralığı sabit dizide tutulur.
+    // record() kilitsizdir ve herhangi bir thread'den (ses callback'i dahil) çağrılabilir:
+    // birkaç relaxed atomik artırma, ayırma veya kilit yok. snapshot() okuyucu tarafıdır;
+    // eşzamanlı kayıtlarla sayaçlar arasında küçük tutarsızlıklar olabilir.
+    class LatencyHistogram : private NonCopyable {
+    public:
+        static constexpr int SUB_BUCKET_BITS = 4;
+        static constexpr size_t SUB_BUCKETS = size_t(1) << SUB_BUCKET_BITS;
+        static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+        struct Snapshot {
+            uint64_t count = 0;
+            uint64_t sum = 0;
+            uint64_t max = 0;
+            std::vector<uint64_t> buckets;
+
+            uint64_t mean() const { return count ? sum / count : 0; }
+            // p: 0..1; değer kovanın orta noktası olarak döner (max ile sınırlı)
+            uint64_t percentile(double p) const;
+        };
+
+        LatencyHistogram() = default;
+
+        void record(uint64_t value) {
+            buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+            sum_.fetch_add(value, std::memory_order_relaxed);
+            uint64_t current_max = max_.load(std::memory_order_relaxed);
+            while (value > current_max &&
+                   !max_.compare_exchange_weak(current_max, value, std::memory_order_relaxed)) {}
+        }
+
+        template<typename Rep, typename Period>
+        void record(std::chrono::duration<Rep, Period> elapsed) {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+            record(ns > 0 ? static_cast<uint64_t>(ns) : 0);
+        }
+
+        Snapshot snapshot() const;
+        void reset();
+
+        static size_t bucket_index(uint64_t value) {
+            if (value < SUB_BUCKETS) {
+                return static_cast<size_t>(value);
+            }
+            const int exponent = 63 - __builtin_clzll(value);
+            const int shift = exponent - SUB_BUCKET_BITS;
+            const size_t sub = static_cast<size_t>(value >> shift) & (SUB_BUCKETS - 1);
+            return static_cast<size_t>(shift + 1) * SUB_BUCKETS + sub;
+        }
+        static uint64_t bucket_lower_bound(size_t index);
+        static uint64_t bucket_width(size_t index);
+
+    private:
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_{};
+        std::atomic<uint64_t> sum_{0};
+        std::atomic<uint64_t> max_{0};
+    };
+}
+
+#endif
@@ -3,37 +3,157 @@
 
 #include <vector>
 #include <cstdint>
+#include <cstddef>
+#include <algorithm>
 
 namespace core {
+    // RFC 3550 RTP sabit başlığı (12 byte):
+    //  V=2 | P | X | CC | M | PT | sequence (16) | timestamp (32) | SSRC (32)
+    // Sequence numarası uygulama içinde 32 bit taşınır, hatta alt 16 biti yazılır;
+    // alıcı taraf (Collector) genişletmeyi yapar.
+    constexpr size_t RTP_HEADER_SIZE = 12;
+    constexpr uint8_t RTP_VERSION = 2;
+    constexpr uint8_t PAYLOAD_TYPE_OPUS = 111; // Dinamik payload type (RFC 7587 örneklerindeki değer)
+    constexpr uint8_t PAYLOAD_TYPE_CN = 13;        // Konfor gürültüsü / SID (RFC 3389), statik payload type
+    constexpr uint8_t PAYLOAD_TYPE_FEEDBACK = 127; // Alıcı geri bildirim raporu (core/feedback_report.hpp)
+
+    // Alınan/gönderilecek datagram üzerinde kopyasız görünüm.
+    // payload, altta yatan tampon yaşadığı sürece geçerlidir.
+    struct PacketView {
+        uint32_t sequence_number = 0;
+        uint32_t timestamp = 0;
+        uint32_t ssrc = 0;
+        uint8_t payload_type = PAYLOAD_TYPE_OPUS;
+        bool marker = false;
+        const uint8_t* payload = nullptr;
+        size_t payload_size = 0;
+
+        size_t serialized_size() const { return RTP_HEADER_SIZE + payload_size; }
+
+        // Çağıranın datagram tamponuna allocation yapmadan yazar; sığmazsa 0 döner.
+        size_t serialize(uint8_t* out, size_t capacity) const {
+            if (!out || capacity < serialized_size()) { return 0; }
+            out[0] = static_cast<uint8_t>(RTP_VERSION << 6);
+            out[1] = static_cast<uint8_t>((marker ? 0x80 : 0x00) | (payload_type & 0x7F));
+            out[2] = static_cast<uint8_t>(sequence_number >> 8);
+            out[3] = static_cast<uint8_t>(sequence_number);
+            write_u32(out + 4, timestamp);
+            write_u32(out + 8, ssrc);
+            if (payload_size > 0) {
+                std::copy(payload, payload + payload_size, out + RTP_HEADER_SIZE);
+            }
+            return serialized_size();
+        }
+
+        // Başlığı çözer, payload'ı kopyalamadan bytes içine işaret ettirir.
+        // CSRC listesi, header extension ve padding atlanır. Geçersiz pakette false döner.
+        static bool parse(const uint8_t* bytes, size_t size, PacketView& view) {
+            if (!bytes || size < RTP_HEADER_SIZE) { return false; }
+            if ((bytes[0] >> 6) != RTP_VERSION) { return false; }
+
+            const bool has_padding = (bytes[0] & 0x20) != 0;
+            const bool has_extension = (bytes[0] & 0x10) != 0;
+            const size_t csrc_count = bytes[0] & 0x0F;
+
+            size_t offset = RTP_HEADER_SIZE + csrc_count * 4;
+            if (offset > size) { return false; }
+            if (has_extension) {
+                if (offset + 4 > size) { return false; }
+                const size_t extension_words = (static_cast<size_t>(bytes[offset + 2]) << 8) | bytes[offset + 3];
+                offset += 4 + extension_words * 4;
+                if (offset > size) { return false; }
+            }
+            size_t end = size;
+            if (has_padding) {
+                const size_t padding = bytes[size - 1];
+                if (padding == 0 || offset + padding > size) { return false; }
+                end -= padding;
+            }
+
+            view.marker = (bytes[1] & 0x80) != 0;
+            view.payload_type = bytes[1] & 0x7F;
+            view.sequence_number = (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3];
+            view.timestamp = read_u32(bytes + 4);
+            view.ssrc = read_u32(bytes + 8);
+            view.payload = bytes + offset;
+            view.payload_size = end - offset;
+            return true;
+        }
+
+    private:
+        static void write_u32(uint8_t* out, uint32_t value) {
+            out[0] = static_cast<uint8_t>(value >> 24);
+            out[1] = static_cast<uint8_t>(value >> 16);
+            out[2] = static_cast<uint8_t>(value >> 8);
+            out[3] = static_cast<uint8_t>(value);
+        }
+
+        static uint32_t read_u32(const uint8_t* in) {
+            return (static_cast<uint32_t>(in[0]) << 24) |
+                   (static_cast<uint32_t>(in[1]) << 16) |
+                   (static_cast<uint32_t>(in[2]) << 8)  |
+                   (static_cast<uint32_t>(in[3]));
+        }
+    };
+
     struct Packet {
-        uint32_t sequence_number;
+        static constexpr size_t HEADER_SIZE = RTP_HEADER_SIZE;
+
+        uint32_t sequence_number = 0;
+        uint32_t timestamp = 0;  // Medya saati (örnekleme hızı biriminde)
+        uint32_t ssrc = 0;       // Akış kimliği
+        uint8_t payload_type = PAYLOAD_TYPE_OPUS;
+        bool marker = false;     // Konuşma başlangıcı (talkspurt)
         std::vector<uint8_t> data;
 
+        PacketView view() const {
+            PacketView v;
+            v.sequence_number = sequence_number;
+            v.timestamp = timestamp;
+            v.ssrc = ssrc;
+            v.payload_type = payload_type;
+            v.marker = marker;
+            v.payload = data.data();
+            v.payload_size = data.size();
+            return v;
+        }
+
+        size_t serialized_size() const { return HEADER_SIZE + data.size(); }
+
+        // Çağıranın tamponuna allocation yapmadan yazar; sığmazsa 0 döner.
+        size_t serialize(uint8_t* out, size_t capacity) const {
+            return view().serialize(out, capacity);
+        }
+
         std::vector<uint8_t> to_bytes() const {
-            std::vector<uint8_t> bytes;
-            bytes.reserve(4 + data.size());
-            bytes.push_back(sequence_number >> 24);
-            bytes.push_back(sequence_number >> 16);
-            bytes.push_back(sequence_number >> 8);
-            bytes.push_back(sequence_number);
-            bytes.insert(bytes.end(), data.begin(), data.end());
+            std::vector<uint8_t> bytes(serialized_size());
+            serialize(bytes.data(), bytes.size());
             return bytes;
         }
 
-        static Packet from_bytes(const std::vector<uint8_t>& bytes) {
+        static Packet from_view(const PacketView& view) {
             Packet packet;
-            if (bytes.size() < 4) {
-                packet.sequence_number = 0;
-                return packet;
-            }
-            packet.sequence_number = (static_cast<uint32_t>(bytes[0]) << 24) |
-                                     (static_cast<uint32_t>(bytes[1]) << 16) |
-                                     (static_cast<uint32_t>(bytes[2]) << 8)  |
-                                     (static_cast<uint32_t>(bytes[3]));
-            packet.data.assign(bytes.begin() + 4, bytes.end());
+            packet.sequence_number = view.sequence_number;
+            packet.timestamp = view.timestamp;
+            packet.ssrc = view.ssrc;
+            packet.payload_type = view.payload_type;
+            packet.marker = view.marker;
+            packet.data.assign(view.payload, view.payload + view.payload_size);
             return packet;
         }
+
+        static Packet from_bytes(const std::vector<uint8_t>& bytes) {
+            return from_bytes(bytes.data(), bytes.size());
+        }
+
+        static Packet from_bytes(const uint8_t* bytes, size_t size) {
+            PacketView view;
+            if (!PacketView::parse(bytes, size, view)) {
+                return Packet{};
+            }
+            return from_view(view);
+        }
     };
 }
 
-#endif
\ No newline at end of file
+#endif
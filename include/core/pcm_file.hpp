@@ -0,0 +1,24 @@
+#ifndef VOICE_ENGINE_PCM_FILE_HPP
+#define VOICE_ENGINE_PCM_FILE_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace core {
+    // 16 bit PCM dosya okuma/yazma. Uzantısı .wav olan dosyalar RIFF/WAVE olarak,
+    // diğerleri başlıksız little-endian int16 olarak ele alınır (örnekleme hızı ve kanal
+    // sayısı çağıranın verdiği değerlerdir).
+    struct PcmAudio {
+        std::vector<int16_t> samples;   // Kanallar iç içe (interleaved)
+        int sample_rate = 48000;
+        int channels = 1;
+    };
+
+    bool read_pcm_file(const std::string& path, PcmAudio& audio);
+    bool write_pcm_file(const std::string& path, const PcmAudio& audio);
+    // Çok kanallı sesi kanalların ortalamasıyla monoya indirir
+    void downmix_to_mono(PcmAudio& audio);
+}
+
+#endif
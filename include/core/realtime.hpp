@@ -0,0 +1,52 @@
+#ifndef VOICE_ENGINE_REALTIME_HPP
+#define VOICE_ENGINE_REALTIME_HPP
+
+#include <vector>
+#include <cstddef>
+
+namespace core {
+    // Motor thread'lerinin zamanlama sınıfı. Default: SCHED_OTHER (değiştirilmez).
+    enum class SchedPolicy { Default, Fifo, RoundRobin };
+
+    const char* sched_policy_name(SchedPolicy policy);
+    // "default", "fifo" veya "rr"; tanınmayan adda false
+    bool parse_sched_policy(const char* name, SchedPolicy& policy);
+    // "2,3", "4-7" ya da "0,2-3" biçiminde CPU listesi; biçim hatasında false
+    bool parse_cpu_list(const char* text, std::vector<int>& cpus);
+
+    // Tek bir thread'e uygulanacak ayarlar. Thread kendi başlangıcında apply_thread_tuning çağırır.
+    struct ThreadTuning {
+        SchedPolicy policy = SchedPolicy::Default;
+        int priority = 50;        // SCHED_FIFO/RR önceliği; sistemin min..max aralığına sıkıştırılır
+        std::vector<int> cpus;    // Boş: affinity değiştirilmez
+
+        bool enabled() const { return policy != SchedPolicy::Default || !cpus.empty(); }
+    };
+
+    // Motor düzeyi seçenekler: ağ thread'i (olay döngüsü / alıcı) ve işleme thread'leri
+    // (yakalama worker'ı, mixer worker'ları) ayrı ayarlanır.
+    struct RealtimeConfig {
+        ThreadTuning network;
+        ThreadTuning processing;
+        bool lock_memory = false;   // mlockall + heap/stack ön-sayfalama
+    };
+
+    // Bellek kilitliyse her ayarlanan thread yığınının bu kadarını önceden sayfalar
+    constexpr size_t STACK_PREFAULT_BYTES = 256 * 1024;
+
+    // Çağıran thread'e uygular ve thread'i adlandırır (en fazla 15 karakter görünür).
+    // Yetki yoksa (CAP_SYS_NICE / RLIMIT_RTPRIO) uyarı yazar ve varsayılan zamanlamayla devam eder;
+    // geçersiz CPU listesi de yalnızca uyarıdır. Fiilen uygulanan politika döner.
+    SchedPolicy apply_thread_tuning(const ThreadTuning& tuning, const char* thread_name);
+
+    // Sürecin mevcut ve gelecekteki tüm sayfalarını RAM'e kilitler (mlockall MCL_CURRENT|MCL_FUTURE):
+    // ayrılmış tamponlar hemen sayfalanır, sıcak yolda sayfa hatası ve swap olmaz. glibc'de serbest
+    // bırakılan heap sisteme geri verilmez (sonraki ayırmalar yeniden sayfa hatası üretmesin).
+    // Thread'ler başlamadan çağrılmalıdır. Başarısızlıkta (RLIMIT_MEMLOCK) uyarı yazar ve false döner.
+    bool lock_process_memory();
+    bool is_memory_locked();
+    // Çağıran thread'in yığınından bytes kadarına dokunur (ilk dokunuş sayfa hatası başlangıçta olsun)
+    void prefault_stack(size_t bytes);
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef VOICE_ENGINE_SPSC_RING_BUFFER_HPP
+#define VOICE_ENGINE_SPSC_RING_BUFFER_HPP
+
+#include "core/non_copyable.hpp"
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+namespace core {
+    // Tek üretici / tek tüketici (SPSC) kilitsiz halka tampon.
+    // Kapasite ikinin kuvvetine yuvarlanır, indeksler monoton artar ve maske ile sarılır.
+    // Üretici ve tüketici indeksleri ayrı cache line'larda tutulur (false sharing önlenir).
+    // write() yalnızca üretici thread'den, read()/discard() yalnızca tüketici thread'den çağrılmalıdır.
+    template <typename T>
+    class SpscRingBuffer : private NonCopyable {
+        static_assert(std::is_trivially_copyable<T>::value, "SpscRingBuffer yalnızca trivially copyable tipler içindir");
+    public:
+        static constexpr size_t CACHE_LINE_SIZE = 64;
+
+        explicit SpscRingBuffer(size_t min_capacity)
+            : capacity_(round_up_pow2(std::max<size_t>(min_capacity, 2))),
+              mask_(capacity_ - 1),
+              buffer_(capacity_) {}
+
+        // Üretici: en fazla count eleman yazar, yazılan eleman sayısını döner.
+        size_t write(const T* data, size_t count) {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            size_t free_space = capacity_ - (head - cached_tail_);
+            if (free_space < count) {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                free_space = capacity_ - (head - cached_tail_);
+            }
+            const size_t n = std::min(count, free_space);
+            if (n == 0) { return 0; }
+
+            const size_t start = head & mask_;
+            const size_t first = std::min(n, capacity_ - start);
+            std::copy(data, data + first, buffer_.data() + start);
+            std::copy(data + first, data + n, buffer_.data());
+            head_.store(head + n, std::memory_order_release);
+            return n;
+        }
+
+        // Tüketici: en fazla count eleman okur, okunan eleman sayısını döner.
+        size_t read(T* out, size_t count) {
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            size_t available = cached_head_ - tail;
+            if (available < count) {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                available = cached_head_ - tail;
+            }
+            const size_t n = std::min(count, available);
+            if (n == 0) { return 0; }
+
+            const size_t start = tail & mask_;
+            const size_t first = std::min(n, capacity_ - start);
+            std::copy(buffer_.data() + start, buffer_.data() + start + first, out);
+            std::copy(buffer_.data(), buffer_.data() + (n - first), out + first);
+            tail_.store(tail + n, std::memory_order_release);
+            return n;
+        }
+
+        // Tüketici: en fazla count elemanı kopyalamadan atlar.
+        size_t discard(size_t count) {
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            cached_head_ = head_.load(std::memory_order_acquire);
+            const size_t n = std::min(count, cached_head_ - tail);
+            tail_.store(tail + n, std::memory_order_release);
+            return n;
+        }
+
+        bool try_push(const T& item) { return write(&item, 1) == 1; }
+        bool try_pop(T& item) { return read(&item, 1) == 1; }
+
+        // Her iki taraftan da çağrılabilir; eşzamanlı kullanımda yaklaşık değerdir.
+        size_t size() const {
+            const size_t tail = tail_.load(std::memory_order_acquire);
+            const size_t head = head_.load(std::memory_order_acquire);
+            return head - tail;
+        }
+        size_t free_space() const { return capacity_ - size(); }
+        bool empty() const { return size() == 0; }
+        size_t capacity() const { return capacity_; }
+
+    private:
+        static size_t round_up_pow2(size_t v) {
+            size_t p = 1;
+            while (p < v) { p <<= 1; }
+            return p;
+        }
+
+        const size_t capacity_;
+        const size_t mask_;
+        std::vector<T> buffer_;
+
+        // Üretici tarafı
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
+        size_t cached_tail_ = 0;
+
+        // Tüketici tarafı
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{0};
+        size_t cached_head_ = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef VOICE_ENGINE_THREAD_POOL_HPP
+#define VOICE_ENGINE_THREAD_POOL_HPP
+
+#include "core/non_copyable.hpp"
+#include "core/realtime.hpp"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+namespace core {
+    // Sabit sayıda worker ile veri paralel döngü çalıştırıcı.
+    // parallel_for, işi worker'lar ve çağıran thread arasında atomik indeksle paylaştırır
+    // ve tüm indeksler bitene kadar bekler. Aynı anda tek parallel_for çağrısı desteklenir.
+    class ThreadPool : private NonCopyable {
+    public:
+        // thread_count = 0: donanım çekirdek sayısı kadar (çağıran thread dahil).
+        // tuning worker'lara uygulanır; çağıran thread'in ayarı çağıranındır.
+        explicit ThreadPool(size_t thread_count = 0, const ThreadTuning& tuning = ThreadTuning{});
+        ~ThreadPool();
+
+        void parallel_for(size_t count, const std::function<void(size_t)>& task);
+        size_t size() const { return workers_.size() + 1; }
+
+    private:
+        void worker_loop();
+        void run_tasks();
+
+        std::vector<std::thread> workers_;
+        std::mutex mutex_;
+        std::condition_variable start_cv_;
+        std::condition_variable done_cv_;
+        bool stopping_ = false;
+        uint64_t generation_ = 0;
+        size_t active_workers_ = 0;
+
+        const std::function<void(size_t)>* task_ = nullptr;
+        size_t task_count_ = 0;
+        std::atomic<size_t> next_index_{0};
+    };
+}
+
+#endif
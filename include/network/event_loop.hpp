@@ -0,0 +1,129 @@
+#ifndef VOICE_ENGINE_EVENT_LOOP_HPP
+#define VOICE_ENGINE_EVENT_LOOP_HPP
+
+#include "core/non_copyable.hpp"
+#include "core/latency_histogram.hpp"
+#include "core/realtime.hpp"
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <queue>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace network {
+    // Tek thread'li reaktör: soket hazır olma olayları (epoll), zamanlayıcılar (timerfd) ve
+    // başka thread'lerden gönderilen işler (eventfd ile uyandırma) aynı döngüde çalışır.
+    // Handler ve zamanlayıcı callback'leri yalnızca döngü thread'inde çağrılır; böylece bir döngüye
+    // bağlı yüzlerce soket tek thread'le, soket başına thread ve periyodik uyanma olmadan hizmet görür.
+    // Soket olayları Linux'a özgüdür; diğer platformlarda yalnızca zamanlayıcı ve işler çalışır.
+    class EventLoop : private core::NonCopyable {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Task = std::function<void()>;
+        using IoHandler = std::function<void(uint32_t events)>;
+        using TimerId = uint64_t;
+
+        // add_fd/modify_fd olay maskesi ve handler'a gelen olaylar
+        static constexpr uint32_t READABLE = 1u << 0;
+        static constexpr uint32_t WRITABLE = 1u << 1;
+        static constexpr uint32_t FAILED   = 1u << 2;   // Hata/kapanma (her zaman bildirilir)
+
+        struct Stats {
+            uint64_t wakeups = 0;       // Bekleme çağrısından dönüş sayısı
+            uint64_t io_events = 0;
+            uint64_t timers_fired = 0;
+            uint64_t tasks_run = 0;
+            size_t fds = 0;
+            size_t timers = 0;
+            core::SchedPolicy sched_policy = core::SchedPolicy::Default;   // Döngü thread'inde fiilen uygulanan
+        };
+
+        EventLoop();
+        ~EventLoop();
+
+        // start/run'dan önce: döngü thread'i başlarken zamanlama sınıfı, CPU kümesi ve adı uygulanır
+        void set_thread_tuning(const core::ThreadTuning& tuning, const char* thread_name = "event-loop");
+        // Döngüyü kendi thread'inde başlatır
+        bool start();
+        // Döngüyü çağıran thread'de stop'a kadar çalıştırır
+        void run();
+        void stop();
+        bool is_running() const { return is_running_.load(std::memory_order_acquire); }
+        bool in_loop_thread() const;
+
+        // Herhangi bir thread'den: işi döngü thread'inde çalıştırır. Döngü durmuşsa false döner.
+        bool post(Task task);
+
+        // Herhangi bir thread'den çağrılabilir. remove_fd döngü dışından çağrılırsa, döndüğünde
+        // handler'ın çalışmadığı ve bir daha çağrılmayacağı garanti edilir (soket kapatılabilir).
+        bool add_fd(int fd, uint32_t events, IoHandler handler);
+        bool modify_fd(int fd, uint32_t events);
+        void remove_fd(int fd);
+
+        // period sıfırsa tek seferlik. Periyodik zamanlayıcı gecikirse kaçırılan tetiklemeler
+        // toplu çalıştırılmaz, bir sonraki periyoda atlanır.
+        TimerId add_timer(Clock::duration delay, Task callback, Clock::duration period = Clock::duration::zero());
+        void cancel_timer(TimerId id);
+
+        Stats get_stats() const;
+        // Zamanlayıcı uyanma gecikmesi: tetiklenme anı - deadline (uyanma başına en eski zamanlayıcı).
+        // Zamanlama gecikmesini (scheduler, CPU çekişmesi) doğrudan ölçer.
+        core::LatencyHistogram::Snapshot wakeup_lateness() const { return wakeup_lateness_.snapshot(); }
+
+    private:
+        struct Timer {
+            Clock::time_point deadline;
+            Clock::duration period;
+            Task callback;
+        };
+        struct TimerEntry {
+            Clock::time_point deadline;
+            TimerId id;
+            bool operator>(const TimerEntry& other) const { return deadline > other.deadline; }
+        };
+
+        void run_loop();
+        void run_tasks();
+        void run_timers();
+        void dispatch_io(int fd, uint32_t events);
+        void remove_fd_now(int fd);
+        void arm_timer_locked();
+        void wake();
+
+        mutable std::mutex mutex_;
+        std::condition_variable wake_cv_;    // Soket olayı olmayan platformlarda bekleme
+        std::vector<Task> pending_tasks_;
+        std::vector<Task> running_tasks_;    // Yalnızca döngü thread'i
+        std::unordered_map<int, std::shared_ptr<IoHandler>> handlers_;
+        std::unordered_map<TimerId, std::shared_ptr<Timer>> timers_;
+        std::priority_queue<TimerEntry, std::vector<TimerEntry>, std::greater<TimerEntry>> timer_queue_;
+        std::vector<std::pair<TimerId, std::shared_ptr<Timer>>> due_timers_;   // Yalnızca döngü thread'i
+        TimerId next_timer_id_ = 1;
+
+        int epoll_fd_ = -1;
+        int wake_fd_ = -1;    // eventfd
+        int timer_fd_ = -1;   // timerfd: en yakın zamanlayıcıya kurulur
+
+        std::thread thread_;
+        std::atomic<std::thread::id> loop_thread_id_{};
+        core::ThreadTuning tuning_;
+        const char* thread_name_ = "event-loop";
+        std::atomic<core::SchedPolicy> sched_policy_{core::SchedPolicy::Default};
+        core::LatencyHistogram wakeup_lateness_;
+        std::atomic<bool> is_running_{false};
+        std::atomic<bool> stop_requested_{false};
+
+        std::atomic<uint64_t> wakeups_{0};
+        std::atomic<uint64_t> io_events_{0};
+        std::atomic<uint64_t> timers_fired_{0};
+        std::atomic<uint64_t> tasks_run_{0};
+    };
+}
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef VOICE_ENGINE_IMPAIRMENT_HPP
+#define VOICE_ENGINE_IMPAIRMENT_HPP
+
+#include "core/non_copyable.hpp"
+#include "network/udp_receiver.hpp"
+#include "network/udp_sender.hpp"
+#include <vector>
+#include <queue>
+#include <random>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+namespace network {
+    // Ağ bozulma parametreleri. Tüm rastgelelik seed'den türetilir: aynı seed ve aynı
+    // gönderim zamanları her koşuda aynı kayıp/gecikme dizisini üretir.
+    struct ImpairmentConfig {
+        enum class LossModel { None, Bernoulli, GilbertElliott };
+        enum class DelayDistribution { Constant, Uniform, Normal, Pareto };
+
+        uint64_t seed = 1;
+
+        LossModel loss_model = LossModel::None;
+        double loss_rate = 0.0;                       // Bernoulli kayıp olasılığı
+        // Gilbert-Elliott: iyi/kötü durumlu Markov zinciri (patlamalı kayıp)
+        double good_to_bad = 0.01;                    // İyi -> kötü geçiş olasılığı (paket başına)
+        double bad_to_good = 0.3;                     // Kötü -> iyi geçiş olasılığı
+        double loss_in_good = 0.0;                    // İyi durumda kayıp olasılığı
+        double loss_in_bad = 1.0;                     // Kötü durumda kayıp olasılığı
+
+        std::chrono::microseconds base_delay{0};      // Sabit tek yön gecikme
+        DelayDistribution jitter_distribution = DelayDistribution::Constant;
+        // Uniform: [-jitter, +jitter], Normal: sigma, Pareto: ölçek (yalnızca pozitif, ağır kuyruk)
+        std::chrono::microseconds jitter{0};
+
+        double reorder_rate = 0.0;                    // Ek gecikmeyle sonrakilerin gerisine düşen paketler
+        std::chrono::microseconds reorder_delay{20000};
+        double duplicate_rate = 0.0;
+
+        uint64_t bandwidth_bps = 0;                   // 0: sınırsız
+        size_t queue_limit_bytes = 64 * 1024;         // Darboğaz kuyruğu; dolunca kuyruk sonu düşürme
+    };
+
+    // Sanal veya gerçek zamanla sürülebilen deterministik bozulma modeli.
+    // Her gönderilen paket için 0 (kayıp), 1 veya 2 (tekrar) teslim zamanı üretir.
+    class ImpairmentModel {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct Stats {
+            uint64_t sent = 0;
+            uint64_t delivered = 0;      // Tekrarlar dahil teslim edilen datagramlar
+            uint64_t lost = 0;           // Kayıp modeli tarafından düşürülen
+            uint64_t queue_drops = 0;    // Bant genişliği kuyruğu taştığı için düşürülen
+            uint64_t duplicated = 0;
+            uint64_t reordered = 0;      // Ek gecikme verilen paketler
+        };
+
+        explicit ImpairmentModel(const ImpairmentConfig& config);
+
+        // sent: gönderim anı (monoton artmalıdır), bytes: datagram boyutu.
+        // deliveries temizlenip teslim zamanlarıyla doldurulur.
+        void process(Clock::time_point sent, size_t bytes, std::vector<Clock::time_point>& deliveries);
+        Stats get_stats() const { return stats_; }
+        const ImpairmentConfig& config() const { return config_; }
+
+    private:
+        bool should_drop();
+        Clock::duration sample_delay();
+
+        const ImpairmentConfig config_;
+        // Her bozulmanın kendi rastgele akışı vardır (seed'den türetilir): bir parametreyi veya
+        // gecikme dağılımını değiştirmek diğer bozulmaların dizisini kaydırmaz
+        std::mt19937_64 loss_rng_;
+        std::mt19937_64 delay_rng_;
+        std::mt19937_64 reorder_rng_;
+        std::mt19937_64 duplicate_rng_;
+        std::uniform_real_distribution<double> uniform_{0.0, 1.0};
+        std::normal_distribution<double> normal_{0.0, 1.0};
+        bool bad_state_ = false;
+        Clock::time_point link_free_{};
+        Stats stats_;
+    };
+
+    // Yerel UDP proxy: listen_port'a gelen datagramları modelden geçirip hedefe iletir.
+    // Gönderen ve alıcı motor değiştirilmeden araya girer (ör. 9001 -> proxy 9101 -> 9001).
+    class ImpairmentProxy : private core::NonCopyable {
+    public:
+        explicit ImpairmentProxy(const ImpairmentConfig& config);
+        ~ImpairmentProxy();
+
+        bool start(int listen_port, const std::string& target_ip, int target_port);
+        void stop();
+        ImpairmentModel::Stats get_stats() const;
+
+    private:
+        struct Scheduled {
+            ImpairmentModel::Clock::time_point due;
+            uint64_t order;              // Aynı teslim anında gönderim sırası korunur
+            std::vector<uint8_t> data;
+            bool operator>(const Scheduled& other) const {
+                return due != other.due ? due > other.due : order > other.order;
+            }
+        };
+
+        void on_datagram(const uint8_t* data, size_t size);
+        void forward_loop();
+
+        ImpairmentModel model_;
+        UdpReceiver receiver_;
+        UdpSender sender_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable wakeup_;
+        std::priority_queue<Scheduled, std::vector<Scheduled>, std::greater<Scheduled>> queue_;
+        std::vector<ImpairmentModel::Clock::time_point> deliveries_;
+        uint64_t next_order_ = 0;
+
+        std::thread forward_thread_;
+        std::atomic<bool> is_running_{false};
+    };
+}
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef VOICE_ENGINE_IO_URING_HPP
+#define VOICE_ENGINE_IO_URING_HPP
+
+#include "core/non_copyable.hpp"
+#include <cstdint>
+#include <cstddef>
+
+// VOICE_ENGINE_IO_URING derleme sisteminden gelir (çekirdek başlıkları yeterince yeniyse).
+// liburing gerekmez: halkalar doğrudan io_uring_setup/io_uring_enter/io_uring_register ile kurulur.
+// <linux/io_uring.h> yalnızca .cpp dosyalarında dahil edilir (linux/fs.h makroları sızmasın).
+#ifdef VOICE_ENGINE_IO_URING
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+#endif
+
+namespace network {
+    // UdpSender/UdpReceiver G/Ç yolu. Auto: çekirdek destekliyorsa io_uring, yoksa soket çağrıları.
+    enum class IoBackend { Auto, Socket, IoUring };
+
+    const char* io_backend_name(IoBackend backend);
+    // "auto", "socket" veya "io_uring"; tanınmayan adda false
+    bool parse_io_backend(const char* name, IoBackend& backend);
+
+#ifdef VOICE_ENGINE_IO_URING
+    // Tek iş parçacığından kullanılan asgari io_uring sarmalayıcısı: SQ/CQ halkaları, tek bir
+    // provided-buffer grubu. Gönderim için SQE'ler toplanıp tek io_uring_enter ile verilir;
+    // tamamlanmalar paylaşılan bellekten syscall'sız okunur.
+    class IoUring : private core::NonCopyable {
+    public:
+        // io_uring_setup çalışıyor ve RECVMSG/SENDMSG ile provided-buffer ring destekleniyor mu
+        // (seccomp/container kısıtları dahil). Sonuç ilk çağrıda ölçülüp saklanır.
+        static bool is_supported();
+
+        IoUring() = default;
+        ~IoUring();
+
+        // cq_entries 0 ise çekirdek varsayılanı (2 x entries); multishot alımda CQ taşmaması için büyütülür
+        bool init(unsigned entries, unsigned cq_entries = 0);
+        bool is_initialized() const { return ring_fd_ >= 0; }
+        // Tamamlanma olduğunda okunabilir olur; EventLoop'a kaydedilir
+        int fd() const { return ring_fd_; }
+
+        // SQ doluysa nullptr; dönen SQE sıfırlanmıştır
+        io_uring_sqe* get_sqe();
+        // Bekleyen SQE'leri çekirdeğe verir; verilen sayı ya da -errno
+        int submit();
+        unsigned pending() const { return sqe_tail_ - submitted_tail_; }
+
+        io_uring_cqe* peek_cqe();
+        void cqe_seen();
+        // CQ taşmışsa çekirdekte bekleyen tamamlanmaları halkaya aktarır (io_uring_enter GETEVENTS).
+        // Taşma varken halka fd'si okunabilir kalır; boşaltılmazsa döngü boşa döner.
+        bool flush_overflow();
+
+        // Tek provided-buffer grubu: count (2'nin kuvveti) adet buffer_size baytlık tampon
+        bool setup_buffer_ring(uint16_t group, unsigned count, size_t buffer_size);
+        uint8_t* buffer(uint16_t id) const { return buffers_ + static_cast<size_t>(id) * buffer_size_; }
+        size_t buffer_size() const { return buffer_size_; }
+        // İşlenen tamponu çekirdeğe geri verir (yayınlama publish_buffers ile)
+        void recycle_buffer(uint16_t id);
+        void publish_buffers();
+
+    private:
+        int ring_fd_ = -1;
+        unsigned sq_entries_ = 0;
+
+        void* sq_ring_ = nullptr;
+        size_t sq_ring_size_ = 0;
+        void* cq_ring_ = nullptr;
+        size_t cq_ring_size_ = 0;
+        io_uring_sqe* sqes_ = nullptr;
+        size_t sqes_size_ = 0;
+
+        unsigned* sq_head_ = nullptr;
+        unsigned* sq_tail_ = nullptr;
+        unsigned* sq_flags_ = nullptr;
+        unsigned sq_mask_ = 0;
+        unsigned* cq_head_ = nullptr;
+        unsigned* cq_tail_ = nullptr;
+        unsigned cq_mask_ = 0;
+        io_uring_cqe* cqes_ = nullptr;
+        unsigned sqe_tail_ = 0;          // Doldurulan son SQE
+        unsigned submitted_tail_ = 0;    // Çekirdeğe verilen son SQE
+
+        io_uring_buf_ring* buffer_ring_ = nullptr;
+        size_t buffer_ring_size_ = 0;
+        uint8_t* buffers_ = nullptr;
+        size_t buffers_size_ = 0;
+        size_t buffer_size_ = 0;
+        unsigned buffer_mask_ = 0;
+        uint16_t buffer_tail_ = 0;
+        uint16_t buffer_group_ = 0;
+    };
+#endif
+}
+
+#endif
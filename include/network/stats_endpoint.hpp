@@ -0,0 +1,47 @@
+#ifndef VOICE_ENGINE_STATS_ENDPOINT_HPP
+#define VOICE_ENGINE_STATS_ENDPOINT_HPP
+
+#include "core/non_copyable.hpp"
+#include <string>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+namespace network {
+    // İstatistik anlık görüntülerini dışarı açar:
+    //  - socket_path: yerel UNIX domain soketi; her bağlantıya bir JSON satırı yazılıp kapatılır
+    //    (ör. `socat - UNIX-CONNECT:/tmp/voice_engine.sock`)
+    //  - json_path: dump_interval'da bir dosyaya yazılır (geçici dosya + rename, okuyucu yarım görmez)
+    // Snapshot sağlayıcı yalnızca bu endpoint'in thread'inden çağrılır; sıcak yola dokunmaz.
+    class StatsEndpoint : private core::NonCopyable {
+    public:
+        using SnapshotProvider = std::function<std::string()>;
+
+        struct Config {
+            std::string socket_path;                      // Boş: soket yok
+            std::string json_path;                        // Boş: dosya dökümü yok
+            std::chrono::milliseconds dump_interval{1000};
+        };
+
+        explicit StatsEndpoint(const Config& config);
+        ~StatsEndpoint();
+
+        bool start(SnapshotProvider provider);
+        void stop();
+
+    private:
+        bool open_socket();
+        void serve_loop();
+        void serve_client();
+        void write_dump();
+
+        const Config config_;
+        SnapshotProvider provider_;
+        int listen_socket_ = -1;
+        std::thread thread_;
+        std::atomic<bool> is_running_{false};
+    };
+}
+
+#endif
@@ -3,10 +3,17 @@
 
 #include "core/non_copyable.hpp"
 #include "core/packet.hpp"
+#include "core/realtime.hpp"
+#include "network/event_loop.hpp"
+#include "network/io_uring.hpp"
 #include <string>
+#include <vector>
 #include <functional>
 #include <thread>
 #include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
 
 #ifdef _WIN32
 #include <winsock2.h>
@@ -20,15 +27,68 @@
 #endif
 
 namespace network {
+    // Linux'ta alım hazır olma olayıyla (epoll) yapılır: verilen EventLoop'a kaydolur, loop
+    // verilmezse kendi döngüsünü tek thread'de çalıştırır. Callback'ler döngü thread'inde çağrılır.
+    // io_uring varsa alım tek bir multishot RECVMSG ile provided-buffer halkasına yapılır: datagram
+    // başına syscall yoktur, döngü yalnızca halkanın tamamlanma olayıyla uyanır. Çekirdek desteklemezse
+    // recvmmsg yoluna dönülür. Diğer platformlarda SO_RCVTIMEO ile bekleyen alım thread'i kullanılır.
     class UdpReceiver : private core::NonCopyable {
     public:
         using OnPacketReceived = std::function<void(core::Packet)>;
-        UdpReceiver();
+        // Kopyasız yol: data, alım slotuna işaret eder ve yalnızca callback süresince geçerlidir.
+        // source, datagram'ı gönderen adrestir (çok katılımcılı sunucuda demux için).
+        using OnDatagramReceived = std::function<void(const uint8_t* data, size_t size, const sockaddr_in& source)>;
+
+        static constexpr size_t BATCH_SIZE = 32;
+        static constexpr size_t MAX_DATAGRAM_SIZE = 2048;
+        // Tek hazır olma olayında en fazla bu kadar okuma; kalan veri bir sonraki turda
+        // (level-triggered) okunur, böylece yoğun bir soket aynı döngüdeki diğerlerini aç bırakmaz.
+        static constexpr size_t MAX_READS_PER_EVENT = 8;
+        // io_uring alım tamponları: datagram + recvmsg çıktı başlığı ve kaynak adres
+        static constexpr unsigned URING_BUFFER_COUNT = 128;
+        static constexpr size_t URING_BUFFER_SIZE = MAX_DATAGRAM_SIZE + 64;
+        static constexpr unsigned URING_COMPLETION_ENTRIES = 4 * URING_BUFFER_COUNT;
+        // Uzun bir tamamlanma turunda geri verilen tamponlar bu aralıkla yayınlanır (halka boşalmasın)
+        static constexpr unsigned URING_PUBLISH_BATCH = 32;
+
+        struct ReceiverStats {
+            uint64_t datagrams = 0;
+            uint64_t syscalls = 0;
+            uint64_t errors = 0;          // Hata tamamlanmaları (ör. io_uring tampon halkası tükendi: ENOBUFS)
+        };
+
+        explicit UdpReceiver(EventLoop* loop = nullptr);
         ~UdpReceiver();
         bool start(int port, OnPacketReceived callback);
+        bool start_raw(int port, OnDatagramReceived callback);
         void stop();
+        // recvmmsg ile toplu alım (Linux); start'tan önce çağrılmalıdır.
+        void set_batching(bool enabled) { batching_enabled_ = enabled; }
+        // start'tan önce çağrılır; backend() start'tan sonra fiilen kullanılan yolu döndürür.
+        void set_backend(IoBackend backend) { requested_backend_ = backend; }
+        IoBackend backend() const { return active_backend_; }
+        // start'tan önce çağrılır; kendi alım thread'ine/döngüsüne uygulanır. Dışarıdan verilen
+        // döngünün thread'i döngünün sahibi tarafından ayarlanır (EventLoop::set_thread_tuning).
+        void set_thread_tuning(const core::ThreadTuning& tuning) { tuning_ = tuning; }
+        ReceiverStats get_stats() const;
     private:
+        bool open_socket(int port);
+        // Bir datagram okur; okunacak veri yoksa false
+        bool receive_single();
+#ifdef VOICE_ENGINE_IO_URING
+        bool start_uring();
+        void arm_uring_receive();
+        void on_uring_ready();
+        void fallback_to_socket();
+#endif
+#ifdef __linux__
+        void on_readable();
+        // Bir recvmmsg; batch dolduysa (daha fazla veri olabilir) true
+        bool receive_batch();
+#else
         void receive_loop();
+#endif
+        void dispatch(const uint8_t* data, size_t size, const sockaddr_in& source);
 #ifdef _WIN32
         SOCKET socket_ = INVALID_SOCKET;
         WSADATA wsa_data_{};
@@ -36,8 +96,26 @@ namespace network {
         int socket_ = -1;
 #endif
         OnPacketReceived on_packet_received_;
-        std::thread receiver_thread_;
+        OnDatagramReceived on_datagram_received_;
+        EventLoop* loop_;
+        std::unique_ptr<EventLoop> own_loop_;   // loop verilmediyse
+        std::thread receiver_thread_;           // Yalnızca epoll olmayan platformlar
         std::atomic<bool> is_running_{false};
+        bool batching_enabled_ = true;
+        IoBackend requested_backend_ = IoBackend::Auto;
+        IoBackend active_backend_ = IoBackend::Socket;
+        core::ThreadTuning tuning_;
+#ifdef VOICE_ENGINE_IO_URING
+        std::unique_ptr<IoUring> uring_;        // Yalnızca döngü thread'i (kurulum hariç)
+        msghdr uring_msg_{};                    // Multishot RECVMSG şablonu: yalnızca adres alanı
+        bool uring_received_ = false;
+#endif
+
+        // Alım slotları bir kez ayrılır
+        std::vector<uint8_t> slot_storage_;
+        std::atomic<uint64_t> datagram_count_{0};
+        std::atomic<uint64_t> syscall_count_{0};
+        std::atomic<uint64_t> error_count_{0};
     };
 }
 
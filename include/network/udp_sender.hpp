@@ -3,8 +3,15 @@
 
 #include "core/non_copyable.hpp"
 #include "core/packet.hpp"
+#include "network/event_loop.hpp"
+#include "network/io_uring.hpp"
 #include <string>
 #include <vector>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
 
 #ifdef _WIN32
 #include <winsock2.h>
@@ -17,18 +24,87 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <sys/uio.h>
 #include <cstring>
 #endif
 
 namespace network {
+    // Soket bloklamaz. attach() ile bir EventLoop'a bağlanırsa, soket tamponu dolduğunda (EAGAIN)
+    // gönderilemeyen datagramlar sınırlı kuyruğa alınır ve soket yazılabilir olunca döngü
+    // thread'inde sırayla gönderilir; kuyrukta bekleyen varken yeni datagramlar da sıraya girer.
+    // Döngü yoksa ya da kuyruk doluysa datagram atılır ve sayaca yazılır.
+    // io_uring varsa bir batch'in datagramları SENDMSG SQE'leri olarak tek io_uring_enter ile verilir;
+    // EAGAIN'i çekirdek kendisi bekleyip yeniden dener, hazır tamamlanmalar her submit'ten sonra
+    // syscall'sız toplanır. Uçuştaki slotlar tükenirse soket yoluna düşülür.
     class UdpSender : private core::NonCopyable {
     public:
+        static constexpr size_t BATCH_SIZE = 32;
+        static constexpr size_t MAX_DATAGRAM_SIZE = 2048;
+        static constexpr size_t SEND_QUEUE_CAPACITY = 64;   // ~640ms ses (10ms paketlerle)
+        static constexpr size_t URING_SEND_SLOTS = 64;      // Aynı anda uçuşta olabilecek datagram
+
+        struct SenderStats {
+            uint64_t datagrams_sent = 0;
+            uint64_t queued = 0;        // EAGAIN nedeniyle kuyruğa alınan
+            uint64_t dropped = 0;       // Kuyruk yok/dolu olduğu için atılan
+            size_t queue_depth = 0;
+        };
+
         UdpSender();
         ~UdpSender();
         bool connect(const std::string& ip_address, int port);
+        // Sabit hedef olmadan soket açar; yalnızca send_to ile kullanılır (çok hedefli sunucu).
+        bool open();
         void send(const core::Packet& packet);
+        void send(const core::PacketView& packet);
+        // Hazır datagram'ı olduğu gibi iletir (RTP dışı yükler ve proxy için).
+        void send_datagram(const uint8_t* data, size_t size);
+        // Linux'ta sendmmsg ile toplu gönderim; paketler önceden ayrılmış slotlara serialize edilir.
         void send(const std::vector<core::Packet>& packets);
+        void send(const std::vector<core::PacketView>& packets);
+        // packets[i], destinations[i] adresine gönderilir; tek sendmmsg ile farklı hedefler.
+        void send_to(const std::vector<core::PacketView>& packets, const std::vector<sockaddr_in>& destinations);
+        // connect/open'dan sonra çağrılır; döngü sender'dan uzun yaşamalıdır.
+        bool attach(EventLoop* loop);
+        // connect/open'dan önce çağrılır; backend() açıldıktan sonra fiilen kullanılan yolu döndürür.
+        void set_backend(IoBackend backend) { requested_backend_ = backend; }
+        IoBackend backend() const { return uring_enabled() ? IoBackend::IoUring : IoBackend::Socket; }
+        SenderStats get_stats() const;
     private:
+        struct QueuedDatagram {
+            sockaddr_in destination;
+            size_t size;
+        };
+
+        bool uring_enabled() const {
+#ifdef VOICE_ENGINE_IO_URING
+            return uring_ != nullptr;
+#else
+            return false;
+#endif
+        }
+
+        void send_batch(const std::vector<core::PacketView>& packets, const sockaddr_in* destinations);
+        // Kilit tutulurken çağrılır; kuyruk boşsa doğrudan gönderir, EAGAIN'de kuyruğa alır
+        void send_one_locked(const uint8_t* data, size_t size, const sockaddr_in& destination);
+        void enqueue_locked(const uint8_t* data, size_t size, const sockaddr_in& destination);
+        void flush_queue();
+        void set_write_interest_locked(bool enabled);
+        void report_send_error();
+#ifdef VOICE_ENGINE_IO_URING
+        struct UringSlot {
+            msghdr message;
+            iovec vector;
+            sockaddr_in destination;
+        };
+        bool start_uring();
+        // Boş slotun tamponu; yoksa nullptr. Tampon doldurulduktan sonra prepare_uring_locked çağrılır.
+        uint8_t* acquire_uring_slot_locked(size_t& slot);
+        bool prepare_uring_locked(size_t slot, size_t size, const sockaddr_in& destination);
+        void submit_uring_locked();
+        void reap_uring_locked();
+#endif
+
 #ifdef _WIN32
         SOCKET socket_ = INVALID_SOCKET;
         WSADATA wsa_data_{};
@@ -36,6 +112,32 @@ namespace network {
         int socket_ = -1;
 #endif
         sockaddr_in server_address_{};
+        std::vector<uint8_t> send_buffer_;
+        std::vector<core::PacketView> packet_views_;
+
+        // Gönderim kuyruğu: üretici thread ile döngü thread'i arasında kilitli, önceden ayrılmış halka
+        mutable std::mutex send_mutex_;
+        EventLoop* loop_ = nullptr;
+        std::vector<uint8_t> queue_storage_;
+        std::vector<QueuedDatagram> queue_entries_;
+        size_t queue_head_ = 0;
+        size_t queue_size_ = 0;
+        bool write_interest_ = false;
+        std::atomic<uint64_t> sent_count_{0};
+        std::atomic<uint64_t> queued_count_{0};
+        std::atomic<uint64_t> dropped_count_{0};
+
+        IoBackend requested_backend_ = IoBackend::Auto;
+#ifdef VOICE_ENGINE_IO_URING
+        std::unique_ptr<IoUring> uring_;
+        std::vector<UringSlot> uring_slots_;
+        std::vector<uint8_t> uring_storage_;
+        std::vector<size_t> free_uring_slots_;
+#endif
+#ifdef __linux__
+        std::vector<mmsghdr> batch_headers_;
+        std::vector<iovec> batch_iovecs_;
+#endif
     };
 }
 
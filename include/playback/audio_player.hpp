@@ -2,10 +2,16 @@
 #define VOICE_ENGINE_AUDIO_PLAYER_HPP
 
 #include "core/non_copyable.hpp"
+#include "core/spsc_ring_buffer.hpp"
+#include "processing/comfort_noise.hpp"
+#include "processing/resampler.hpp"
+#include "processing/time_scale_modifier.hpp"
+#include "playback/drift_estimator.hpp"
 #include <portaudio.h>
 #include <vector>
 #include <cstdint>
-#include <mutex>
+#include <cstddef>
+#include <atomic>
 #include <functional>
 
 namespace playback {
@@ -15,6 +21,22 @@ namespace playback {
         static constexpr int NUM_CHANNELS = 1;
         static constexpr PaSampleFormat FORMAT = paInt16;
         static constexpr int FRAMES_PER_BUFFER = 480;
+        static constexpr size_t MAX_BUFFER_SAMPLES = SAMPLE_RATE * NUM_CHANNELS * 2; // 2 saniye
+        static constexpr size_t ACCELERATE_MARGIN = SAMPLE_RATE / 50;                // 20 ms
+        static constexpr double MAX_TIME_SCALE_RATE = 0.08;                          // ±%8
+
+        // Oynatma sağlığı sayaçları (log spam yerine)
+        struct PlayoutStats {
+            uint64_t underruns = 0;       // Yeterli veri olmadan tetiklenen callback sayısı
+            uint64_t overruns = 0;        // Tampon dolu olduğu için kesilen submit sayısı
+            uint64_t dropped_samples = 0; // Taşma nedeniyle atılan sample sayısı
+            uint64_t comfort_noise_samples = 0; // Sessizlik (DTX) sırasında üretilen gürültü
+            size_t buffered_samples = 0;  // Anlık tampon doluluğu
+            size_t target_samples = 0;    // Kayma telafisinin hedeflediği doluluk
+            double drift_ppm = 0.0;       // Tahmini saat kayması (pozitif: gönderici hızlı)
+            uint64_t accelerated_samples = 0;   // Zaman ölçeklemeyle çıkarılan (hızlandırma)
+            uint64_t expanded_samples = 0;      // Zaman ölçeklemeyle eklenen (yavaşlatma)
+        };
 
         AudioPlayer();
         ~AudioPlayer();
@@ -23,20 +45,71 @@ namespace playback {
 
         bool start();
         void stop();
+        // Tek üretici thread'den (decode/network) çağrılmalıdır.
         void submit_audio_data(const std::vector<int16_t>& audio_data);
+        void submit_audio_data(const int16_t* samples, size_t count);
         bool is_playing() const;
         void set_playback_callback(PlaybackCallback cb);
+        PlayoutStats get_stats() const;
+        size_t buffered_samples() const { return audio_buffer_.size(); }
+
+        // Saat kayması telafisi: gelen ses, tampon doluluğunu hedefte tutacak oranla kesirli
+        // olarak yeniden örneklenir (üretici thread'inde; ses callback'ine maliyet eklenmez).
+        // Varsayılan açık; ayarlar start/submit öncesinde yapılmalıdır.
+        void set_drift_compensation(bool enabled) { drift_compensation_ = enabled; }
+        void set_target_buffer(size_t samples) { drift_estimator_.set_target(samples); }
+        // Gecikme denetimi: tampon hedefin ACCELERATE_MARGIN fazlasını aşarsa (jitter sıçraması
+        // sonrası) oynatma perdeyi koruyarak hızlandırılır, hedefin çok altına düşerse yavaşlatılır.
+        // Ortalama hız değişimi MAX_TIME_SCALE_RATE ile sınırlıdır. Varsayılan açık.
+        void set_latency_control(bool enabled) { latency_control_ = enabled; }
+
+        // Karşı taraf sessizlikteyken (SID alındı) tampon boşalınca sessizlik yerine verilen
+        // seviyede konfor gürültüsü çalınır ve bu underrun sayılmaz. Herhangi bir thread'den çağrılabilir.
+        void start_comfort_noise(uint8_t level);
+        void stop_comfort_noise();
+        bool comfort_noise_active() const { return comfort_noise_level_.load(std::memory_order_relaxed) >= 0; }
+
+        // Oynatma callback'inin yaptığını yapar: tampondan frames örnek okur, eksikse sessizlikle
+        // (DTX sessizliğinde konfor gürültüsüyle) doldurur. Aygıt olmadan (bench/çevrimdışı) tüketici olarak kullanılabilir; akış
+        // başlatılmışken yalnızca ses thread'i çağırır (tek tüketici).
+        void render(int16_t* output, size_t frames);
 
     private:
+        processing::TimeScaleModifier::Mode choose_time_scale(size_t buffered, size_t count, bool resumed);
+
         static int pa_callback(const void*, void*, unsigned long, const PaStreamCallbackTimeInfo*, PaStreamCallbackFlags, void*);
-        int process(int16_t*, unsigned long);
 
         PaStream *stream_ = nullptr;
         bool is_playing_ = false;
 
-        std::vector<int16_t> audio_buffer_;
-        std::mutex buffer_mutex_;
+        core::SpscRingBuffer<int16_t> audio_buffer_{MAX_BUFFER_SAMPLES};
+        std::vector<int16_t> playback_frame_;
         PlaybackCallback playback_callback_;
+        processing::ComfortNoiseGenerator comfort_noise_;   // Yalnızca render() kullanır
+
+        // Yalnızca üretici thread'i
+        bool drift_compensation_ = true;
+        DriftEstimator drift_estimator_;
+        processing::FractionalResampler resampler_;
+        std::vector<int16_t> resampled_;
+        bool latency_control_ = true;
+        processing::TimeScaleModifier time_scaler_;
+        std::vector<int16_t> scaled_;
+        double time_scale_credit_ = 0.0;   // Hız sınırı: eklenen/çıkarılabilecek örnek bütçesi
+        uint64_t seen_underruns_ = 0;
+
+        std::atomic<bool> has_received_data_{false};
+        std::atomic<uint64_t> underrun_count_{0};
+        std::atomic<uint64_t> overrun_count_{0};
+        std::atomic<uint64_t> dropped_samples_{0};
+        std::atomic<int> comfort_noise_level_{-1};           // -1: kapalı, 0..127: SID seviyesi
+        // start_comfort_noise'da kurulur, sonraki submit'te tüketilir: konuşma sonrası ilk blok
+        // stop_comfort_noise'dan sonra gelse de sessizlik dönüşü olarak görülür
+        std::atomic<bool> resume_pending_{false};
+        std::atomic<uint64_t> comfort_noise_samples_{0};
+        std::atomic<double> drift_ppm_{0.0};
+        std::atomic<uint64_t> accelerated_samples_{0};
+        std::atomic<uint64_t> expanded_samples_{0};
     };
 }
 
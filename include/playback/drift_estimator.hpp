@@ -0,0 +1,53 @@
+#ifndef VOICE_ENGINE_DRIFT_ESTIMATOR_HPP
+#define VOICE_ENGINE_DRIFT_ESTIMATOR_HPP
+
+#include <cstddef>
+
+namespace playback {
+    // Gönderici (uzak yakalama) saati ile çıkış aygıtı saati arasındaki kaymayı oynatma
+    // tamponunun zaman içindeki doluluğundan tahmin eder. Yumuşatılmış doluluk hatası üzerinde
+    // PI denetleyici: integral terimi kalıcı saat kaymasını (ppm) izler, oransal terim tamponu
+    // hedefe geri çeker. Çıktı, tamponu hedefte tutacak resampler oranıdır (çıkış/giriş).
+    // Zaman tabanı eklenen örneklerdir; duvar saati gerekmez (çevrimdışı/bench'te de çalışır).
+    class DriftEstimator {
+    public:
+        struct Config {
+            int sample_rate = 48000;
+            size_t target_samples = 960;          // Hedef tampon doluluğu (20 ms)
+            double smoothing_seconds = 1.0;       // Doluluk ortalamasının zaman sabiti
+            double correction_per_second = 0.1;   // Oran düzeltmesi / (saniye cinsinden doluluk hatası)
+            double integral_seconds = 30.0;       // Kayma tahmininin oturma süresi
+            double max_correction = 0.005;        // Oran 1 ± bu değerle sınırlı (~8.6 cent)
+            // Bundan büyük doluluk hatası saat kayması değil jitter sıçramasıdır (zaman ölçekleme
+            // boşaltır); kayma tahmini güncellenmez
+            double max_tracking_error_seconds = 0.02;
+        };
+
+        DriftEstimator();
+        explicit DriftEstimator(const Config& config);
+
+        // Her eklemede, yazmadan önceki doluluk ve eklenecek örnek sayısıyla çağrılır.
+        // Uygulanacak oranı döndürür.
+        double update(size_t buffered_samples, size_t submitted_samples);
+        // Süreksizlik (underrun, DTX sessizliği) sonrası: doluluk ortalaması yeniden başlar,
+        // bu arada tampon boş kaldığı için kayma tahmini güncellenmez.
+        void hold() { holding_ = true; }
+        void reset();
+
+        void set_target(size_t samples) { config_.target_samples = samples; }
+        size_t target() const { return config_.target_samples; }
+        double ratio() const { return ratio_; }
+        // Pozitif: gönderici saati hızlı (tampon doluyor, oran 1'in altında)
+        double drift_ppm() const { return drift_ * 1e6; }
+        double smoothed_fill() const { return smoothed_fill_; }
+
+    private:
+        Config config_;
+        double smoothed_fill_ = 0.0;
+        double drift_ = 0.0;       // Integral terimi: tahmini kesirli saat farkı
+        double ratio_ = 1.0;
+        bool holding_ = true;
+    };
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef VOICE_ENGINE_AUDIO_FRAME_HPP
+#define VOICE_ENGINE_AUDIO_FRAME_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace processing {
+    // İşleme zincirinde dolaşan çerçeve tanımlayıcısı: örnekler + tembel hesaplanan,
+    // önbelleğe alınan özellikler (enerji/RMS, tepe, ZCR). Her özellik çerçeve başına en fazla
+    // bir kez hesaplanır; örnekleri değiştiren aşama mutable_data()/mutable_samples() üzerinden
+    // yazar ve bu çağrı tüm önbelleği geçersiz kılar. Yeni özellik (ör. spektral bantlar)
+    // Feature bayrağı + önbellek alanı eklenerek aynı düzenle tanımlanır.
+    class AudioFrame {
+    public:
+        AudioFrame() = default;
+        explicit AudioFrame(size_t capacity) { samples_.reserve(capacity); }
+
+        void assign(const int16_t* samples, size_t count) {
+            samples_.assign(samples, samples + count);
+            invalidate();
+        }
+
+        const int16_t* data() const { return samples_.data(); }
+        size_t size() const { return samples_.size(); }
+        bool empty() const { return samples_.empty(); }
+        const std::vector<int16_t>& samples() const { return samples_; }
+
+        // Yazma erişimi: önbellek hemen geçersiz kılınır, dönen tampona yazılanlar
+        // sonraki özellik sorgularında yeniden hesaplanır.
+        int16_t* mutable_data() { invalidate(); return samples_.data(); }
+        std::vector<int16_t>& mutable_samples() { invalidate(); return samples_; }
+        void invalidate() { valid_ = 0; }
+
+        uint64_t energy() const;          // Kareler toplamı (kesin)
+        float mean_energy() const;        // energy / size
+        float rms() const;
+        int32_t peak() const;             // En büyük mutlak değer
+        float zero_crossing_rate() const; // Sıfır geçişi / (size - 1)
+
+    private:
+        enum Feature : uint32_t {
+            ENERGY = 1u << 0,
+            PEAK = 1u << 1,
+            ZERO_CROSSINGS = 1u << 2,
+        };
+
+        std::vector<int16_t> samples_;
+        mutable uint32_t valid_ = 0;
+        mutable uint64_t energy_ = 0;
+        mutable int32_t peak_ = 0;
+        mutable size_t zero_crossings_ = 0;
+    };
+}
+
+#endif
@@ -1,34 +1,72 @@
 #ifndef VOICE_ENGINE_AUDIO_GAIN_CONTROLLER_HPP
 #define VOICE_ENGINE_AUDIO_GAIN_CONTROLLER_HPP
 
+#include "core/non_copyable.hpp"
+#include "processing/audio_frame.hpp"
 #include <vector>
+#include <atomic>
 #include <cstdint>
+#include <cstddef>
 
 namespace processing {
-    class AudioGainController {
+    // Otomatik kazanç denetimi + ileri bakışlı tepe sınırlayıcı.
+    // Çerçeve RMS'i izlenir ve hedef seviyeye götüren kazanç (attack/release yumuşatmalı) bulunur;
+    // kazanç çerçeve boyunca örnek başına doğrusal rampa ile değişir (çerçeve sınırında sıçrama yok).
+    // Sınırlayıcı sinyali LOOKAHEAD örnek geciktirir: her BLOCK'luk bölüm için önündeki
+    // BLOCK + LOOKAHEAD örneğin tepesine bakılır ve kazanç tepe gelmeden limit_level'a inecek
+    // şekilde rampalanır. Böylece yükseltilmiş sinyal doyurmayla kırpılmaz. Rampa uygulaması
+    // vektörel apply_gain_ramp çekirdeğiyle yapılır.
+    class AudioGainController : private core::NonCopyable {
     public:
-        explicit AudioGainController(
-            float target_level = 8000.0f,
-            float max_gain = 3.0f,
-            float min_gain = 0.1f,
-            float attack_rate = 0.1f,
-            float release_rate = 0.01f
-        );
-        
+        static constexpr size_t LOOKAHEAD = 96;   // 2 ms @ 48 kHz; çıkış bu kadar gecikir
+        static constexpr size_t BLOCK = 32;       // Sınırlayıcı kazanç noktaları arası (LOOKAHEAD'den büyük olamaz)
+
+        struct Config {
+            float target_level = 8000.0f;     // Hedef RMS
+            float max_gain = 3.0f;
+            float min_gain = 0.1f;
+            float attack_rate = 0.1f;         // Çerçeve başına (seviye/kazanç yükselirken)
+            float release_rate = 0.01f;       // Çerçeve başına (seviye/kazanç düşerken)
+            float limit_level = 29000.0f;     // Sınırlayıcı tavanı (~-1 dBFS)
+            float limiter_release = 0.02f;    // Blok başına sınırlayıcı kazancının 1'e dönüş oranı (~35 ms)
+        };
+
+        struct Stats {
+            float gain = 1.0f;                // AGC kazancı
+            float limiter_gain = 1.0f;        // Son bloğun sınırlayıcı kazancı
+            uint64_t limited_blocks = 0;      // Sınırlayıcının kazanç düşürdüğü bloklar
+        };
+
+        AudioGainController();
+        explicit AudioGainController(const Config& config);
+
         void process(std::vector<int16_t>& samples);
+        // Çerçevenin önbellekli RMS değerini kullanır
+        void process(AudioFrame& frame);
+        void process(int16_t* samples, size_t count);
         void reset();
         float get_current_gain() const { return current_gain_; }
-        
+        size_t latency_samples() const { return LOOKAHEAD; }
+        // Herhangi bir thread'den okunabilir (işleme thread'i çerçeve başına yayınlar)
+        Stats get_stats() const;
+
     private:
-        float calculate_rms(const std::vector<int16_t>& samples);
-        float target_level_;
-        float max_gain_;
-        float min_gain_;
-        float attack_rate_;
-        float release_rate_;
-        float current_gain_;
-        float current_level_;
+        void process(int16_t* samples, size_t count, float rms);
+        void update_gain(float rms);
+
+        Config config_;
+        float current_gain_ = 1.0f;    // Bu çerçevenin sonunda ulaşılacak AGC kazancı
+        float applied_gain_ = 1.0f;    // Önceki çerçevenin sonunda uygulanan AGC kazancı (rampa başlangıcı)
+        float current_level_ = 0.0f;
+        float limiter_gain_ = 1.0f;
+
+        std::vector<int16_t> history_;   // Gecikme hattı: son LOOKAHEAD giriş örneği
+        std::vector<int16_t> window_;    // history_ + çerçeve (ileri bakış penceresi)
+
+        std::atomic<float> published_gain_{1.0f};
+        std::atomic<float> published_limiter_gain_{1.0f};
+        std::atomic<uint64_t> limited_blocks_{0};
     };
 }
 
-#endif
\ No newline at end of file
+#endif
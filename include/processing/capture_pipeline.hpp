@@ -0,0 +1,22 @@
+#ifndef VOICE_ENGINE_CAPTURE_PIPELINE_HPP
+#define VOICE_ENGINE_CAPTURE_PIPELINE_HPP
+
+#include "processing/pipeline.hpp"
+#include "processing/pipeline_stages.hpp"
+#include <cstddef>
+
+namespace processing {
+    // Gönderim tarafının yakalama zinciri (10ms mono @ 48 kHz). Application, çevrimdışı hat ve
+    // ölçümler aynı tipi kullanır; böylece ölçülen zincir gönderilen zincirin kendisidir.
+    // Dört aşamanın hepsi blok aşamasıdır; bu zincirde birleştirilen örnek döngüsü yoktur (çerçeve
+    // başına dört geçiş). VAD, AudioFrame'in SIMD ile hesaplanıp önbelleğe alınan enerji/ZCR
+    // değerlerini okur ve eşikleri kazançtan bağımsız kalsın diye AGC'den önce çalışır. AGC örnek
+    // döngüsüne katılamaz: sınırlayıcı kazancı gelecek LOOKAHEAD örneğin tepesine göre seçer.
+    constexpr size_t CAPTURE_FRAME_SAMPLES = 480;
+    constexpr size_t CAPTURE_CHANNELS = 1;
+
+    using CapturePipeline = Pipeline<CAPTURE_FRAME_SAMPLES, CAPTURE_CHANNELS,
+                                     EchoCancellerStage, NoiseSuppressorStage, VoiceActivityStage, GainStage>;
+}
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef VOICE_ENGINE_COMFORT_NOISE_HPP
+#define VOICE_ENGINE_COMFORT_NOISE_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+namespace processing {
+    // RFC 3389 konfor gürültüsü. Gönderici sessizlikte yalnızca arka plan seviyesini
+    // (SID: -dBov, 0..127) taşır; alıcı bu seviyede yumuşatılmış gürültüyü yerelde üretir.
+    // Spektral şekil (yansıma katsayıları) taşınmaz; üretilen gürültü hafif alçak geçirenden geçer.
+    class ComfortNoiseGenerator {
+    public:
+        static constexpr uint8_t SILENCE_LEVEL = 127;     // -127 dBov: pratikte sessizlik
+        static constexpr size_t SID_PAYLOAD_SIZE = 1;
+
+        // Örneklerin RMS seviyesi, -dBov olarak (0 = tam ölçek, 127 = sessiz)
+        static uint8_t level_from_samples(const int16_t* samples, size_t count);
+        static float level_to_rms(uint8_t level);
+
+        explicit ComfortNoiseGenerator(uint32_t seed = 0x9E3779B9u);
+
+        // Hedef seviye; kazanç tıklama olmaması için birkaç ms içinde kayarak değişir
+        void set_level(uint8_t level);
+        uint8_t level() const { return level_; }
+        void generate(int16_t* out, size_t count);
+
+    private:
+        uint32_t next_random();
+
+        uint32_t state_;
+        uint8_t level_ = SILENCE_LEVEL;
+        float target_gain_ = 0.0f;
+        float gain_ = 0.0f;
+        float lowpass_ = 0.0f;
+    };
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef VOICE_ENGINE_DSP_KERNELS_HPP
+#define VOICE_ENGINE_DSP_KERNELS_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+namespace processing {
+    // int16 PCM üzerinde ortak DSP çekirdekleri. x86'da SSE2/AVX2 sürümleri CPU'ya göre
+    // çalışma zamanında seçilir; tüm sürümler scalar referansla bit düzeyinde aynı sonucu verir.
+    enum class SimdLevel { Scalar, Sse2, Avx2 };
+
+    struct DspKernels {
+        // Kesin kareler toplamı (int64 birikim, taşma yok)
+        uint64_t (*sum_of_squares)(const int16_t* samples, size_t count);
+        // En büyük mutlak değer (-32768 için 32768)
+        int32_t (*peak_abs)(const int16_t* samples, size_t count);
+        // Ardışık örnekler arasında işaret değişimi sayısı (negatif / negatif olmayan)
+        size_t (*zero_crossings)(const int16_t* samples, size_t count);
+        // samples[i] = sat16(round_nearest(float(samples[i]) * gain)); gain [-65535, 65535] ile sınırlanır
+        void (*apply_gain)(int16_t* samples, size_t count, float gain);
+        // Doğrusal kazanç rampası: samples[i] = sat16(round_nearest(float(samples[i]) * (gain + step * i))).
+        // Rampa boyunca kazanç [-65535, 65535] içinde kalmalıdır.
+        void (*apply_gain_ramp)(int16_t* samples, size_t count, float gain, float step);
+        // dst[i] = sat16(dst[i] + src[i])
+        void (*mix_saturate)(int16_t* dst, const int16_t* src, size_t count);
+        // dst[i] = sat16(dst[i] - src[i])
+        void (*subtract_saturate)(int16_t* dst, const int16_t* src, size_t count);
+        // Kesin iç çarpım: sum(a[i] * b[i]), int64 birikim (FIR/polyphase filtreler, tüm girdilerde kesin)
+        int64_t (*dot_product)(const int16_t* a, const int16_t* b, size_t count);
+    };
+
+    // İlk çağrıda CPU desteğine göre belirlenen en iyi seviye
+    SimdLevel dsp_simd_level();
+    const char* dsp_simd_level_name(SimdLevel level);
+    // Belirli bir seviyenin çekirdekleri; desteklenmeyen seviye bir alttakine düşer
+    const DspKernels& dsp_kernels(SimdLevel level);
+    const DspKernels& dsp_kernels();
+
+    inline uint64_t sum_of_squares(const int16_t* samples, size_t count) {
+        return dsp_kernels().sum_of_squares(samples, count);
+    }
+    inline int32_t peak_abs(const int16_t* samples, size_t count) {
+        return dsp_kernels().peak_abs(samples, count);
+    }
+    inline size_t zero_crossings(const int16_t* samples, size_t count) {
+        return dsp_kernels().zero_crossings(samples, count);
+    }
+    inline void apply_gain(int16_t* samples, size_t count, float gain) {
+        dsp_kernels().apply_gain(samples, count, gain);
+    }
+    inline void apply_gain_ramp(int16_t* samples, size_t count, float gain, float step) {
+        dsp_kernels().apply_gain_ramp(samples, count, gain, step);
+    }
+    inline void mix_saturate(int16_t* dst, const int16_t* src, size_t count) {
+        dsp_kernels().mix_saturate(dst, src, count);
+    }
+    inline void subtract_saturate(int16_t* dst, const int16_t* src, size_t count) {
+        dsp_kernels().subtract_saturate(dst, src, count);
+    }
+    inline int64_t dot_product(const int16_t* a, const int16_t* b, size_t count) {
+        return dsp_kernels().dot_product(a, b, count);
+    }
+}
+
+#endif
@@ -1,24 +1,76 @@
 #ifndef VOICE_ENGINE_ECHO_CANCELLER_HPP
 #define VOICE_ENGINE_ECHO_CANCELLER_HPP
 
+#include "core/aligned_buffer.hpp"
+#include "core/spsc_ring_buffer.hpp"
+#include "processing/audio_frame.hpp"
+#include "processing/fft.hpp"
 #include <vector>
 #include <cstdint>
 #include <cstddef>
-#include <mutex>
 
 namespace processing {
+    // Bölümlenmiş blok frekans alanı NLMS (PBFDAF/MDF) yankı giderici.
+    // Kuyruk uzunluğu BLOCK_SIZE'lık bölümlere ayrılır; her blokta uzak uç spektrumu ile
+    // filtre katsayıları çarpılıp toplanarak yankı tahmini yapılır ve mikrofon sinyalinden çıkarılır.
+    // Katsayılar bin başına güç ile normalize edilmiş adımla güncellenir; gradyan kısıtı
+    // her blokta tek bir bölüme sırayla uygulanır. Tüm durum hizalı, ardışık dizilerde tutulur.
+    // on_playback() oynatma thread'inden, process() yakalama thread'inden çağrılır (kilitsiz).
+    // Blok işleme nedeniyle çıkış girişe göre BLOCK_SIZE örnek gecikir.
     class EchoCanceller {
     public:
-        explicit EchoCanceller(size_t max_delay_samples = 48000);
+        static constexpr size_t BLOCK_SIZE = 128;
+        static constexpr size_t FFT_SIZE = BLOCK_SIZE * 2;
+        static constexpr size_t BINS = FFT_SIZE / 2 + 1;
+
+        explicit EchoCanceller(int tail_length_ms = 256, int sample_rate = 48000);
+
         void on_playback(const std::vector<int16_t>& samples);
+        void on_playback(const int16_t* samples, size_t count);
         void process(std::vector<int16_t>& capture);
+        void process(int16_t* capture, size_t count);
+        void process(AudioFrame& capture) { process(capture.mutable_data(), capture.size()); }
+
+        size_t partition_count() const { return partitions_; }
+        size_t latency_samples() const { return BLOCK_SIZE; }
+
     private:
-        std::vector<int16_t> echo_buffer_;
-        size_t max_delay_;
-        std::mutex mutex_;
-        float echo_suppression_factor_;
-        float adaptive_threshold_;
-        float learning_rate_;
+        void process_block();
+        void filter_echo();
+        void adapt(float step_scale);
+        void constrain_partition(size_t partition);
+
+        const size_t partitions_;
+        const size_t max_far_backlog_;
+        core::SpscRingBuffer<int16_t> far_queue_;
+        RealFft fft_;
+
+        // Uzak uç: son iki blok (zaman) ve son partitions_ bloğun spektrumu (halka, en yenisi far_head_)
+        core::AlignedBuffer<float> far_time_;
+        core::AlignedBuffer<float> far_re_;
+        core::AlignedBuffer<float> far_im_;
+        core::AlignedBuffer<float> far_power_;
+        size_t far_head_ = 0;
+
+        // Filtre katsayıları: bölüm başına BINS kompleks değer
+        core::AlignedBuffer<float> weight_re_;
+        core::AlignedBuffer<float> weight_im_;
+
+        // Blok başına yeniden kullanılan çalışma dizileri
+        core::AlignedBuffer<float> spectrum_re_;
+        core::AlignedBuffer<float> spectrum_im_;
+        core::AlignedBuffer<float> time_buffer_;
+        core::AlignedBuffer<float> error_;
+        core::AlignedBuffer<int16_t> far_block_;
+
+        // Giriş/çıkış blok FIFO'ları (480 örneklik çerçeve ile 128 örneklik blok arasında)
+        core::AlignedBuffer<float> near_block_;
+        core::AlignedBuffer<int16_t> out_block_;
+        size_t block_fill_ = 0;
+
+        size_t constrain_index_ = 0;
+        float erle_ = 1.0f;             // Yumuşatılmış yankı kaybı iyileşmesi (enerji oranı)
+        size_t frozen_blocks_ = 0;      // Çift konuşma nedeniyle uyarlanmayan ardışık bloklar
     };
 }
 
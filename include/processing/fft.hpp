@@ -0,0 +1,38 @@
+#ifndef VOICE_ENGINE_FFT_HPP
+#define VOICE_ENGINE_FFT_HPP
+
+#include "core/aligned_buffer.hpp"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace processing {
+    // İkinin kuvveti boyutlu gerçek FFT (N/2 noktalı kompleks FFT + paketleme).
+    // Spektrum ayrık gerçek/sanal dizilerde (SoA) tutulur: N/2 + 1 bin.
+    // forward ölçeklenmez, inverse 1/N ile ölçekler: inverse(forward(x)) == x.
+    class RealFft {
+    public:
+        explicit RealFft(size_t size);
+
+        size_t size() const { return size_; }
+        size_t bins() const { return size_ / 2 + 1; }
+
+        void forward(const float* input, float* out_re, float* out_im);
+        void inverse(const float* in_re, const float* in_im, float* output);
+
+    private:
+        void complex_fft(float* re, float* im, bool inverse) const;
+
+        const size_t size_;
+        const size_t half_;
+        std::vector<uint32_t> bit_reverse_;
+        core::AlignedBuffer<float> twiddle_re_;  // e^{-2πik/half}, k < half/2
+        core::AlignedBuffer<float> twiddle_im_;
+        core::AlignedBuffer<float> split_re_;    // e^{-2πik/size}, k <= half
+        core::AlignedBuffer<float> split_im_;
+        core::AlignedBuffer<float> work_re_;
+        core::AlignedBuffer<float> work_im_;
+    };
+}
+
+#endif
@@ -1,15 +1,32 @@
 #ifndef VOICE_ENGINE_NOISE_SUPPRESSOR_HPP
 #define VOICE_ENGINE_NOISE_SUPPRESSOR_HPP
 
+#include "processing/audio_frame.hpp"
+#include "processing/spectral_noise_suppressor.hpp"
 #include <vector>
+#include <memory>
 #include <cstdint>
+#include <cstddef>
 
 namespace processing {
     class NoiseSuppressor {
     public:
+        // Gate: örnek başına genlik kapısı (eski davranış, gecikmesiz).
+        // Spectral: SpectralNoiseSuppressor (Wiener + minimum istatistik, 10ms gecikme).
+        enum class Engine { Gate, Spectral };
+
         explicit NoiseSuppressor(int16_t initial_threshold = 500, float alpha = 0.95f);
+        explicit NoiseSuppressor(Engine engine);
         void process(std::vector<int16_t>& samples);
+        void process(AudioFrame& frame);
+
+        Engine engine() const { return engine_; }
+
     private:
+        void process_gate(int16_t* samples, size_t count, float rms);
+
+        Engine engine_;
+        std::unique_ptr<SpectralNoiseSuppressor> spectral_;
         float threshold_;
         float noise_level_;
         float alpha_;
@@ -0,0 +1,205 @@
+#ifndef VOICE_ENGINE_PIPELINE_HPP
+#define VOICE_ENGINE_PIPELINE_HPP
+
+#include "core/non_copyable.hpp"
+#include "processing/audio_frame.hpp"
+#include <tuple>
+#include <utility>
+#include <type_traits>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+namespace processing {
+    // Aşamalar arasında çerçeve başına dolaşan durum
+    struct FrameContext {
+        AudioFrame& frame;
+        bool voice = true;   // VAD aşaması yoksa her çerçeve ses sayılır
+    };
+
+    // Derleme zamanında kurulan işleme zinciri. Aşamalar değer olarak (tuple) tutulur; sıcak yolda
+    // sanal çağrı ve allocation yoktur. Bir aşama şu kancalardan uygun olanları tanımlar:
+    //   void process_frame(FrameContext&)        - blok aşaması (FFT, blok filtre); çerçeveyi kendisi dolaşır
+    //   float process_sample(float)              - örnek aşaması; örneği değiştirir
+    //   void observe_sample(float)               - örnek aşaması; yalnızca okur (ölçüm, analiz)
+    //   void begin_frame(FrameContext&), void end_frame(FrameContext&) - örnek aşamasının çerçeve kancaları
+    // Ardışık örnek aşamaları tek döngüde birleştirilir: çerçeve bir kez float'a açılır, her örnek
+    // sırayla tüm aşamalardan geçer ve (değiştiren aşama varsa) tek doyurmayla geri yazılır.
+    // Böylece ardışık analiz/kazanç aşamaları, aralarındaki blok aşamaları dışında tek sıcak geçiş yapar.
+    // Her aşama bir Config yapısı ve (varsayılan, Config) kurucuları sunar; zincir ya varsayılan
+    // kurulur ya da aşama sırasıyla Config'ler verilir. Aşamalar yerinde kurulur (taşınması gerekmez).
+    template <size_t FrameSamples, size_t Channels, typename... Stages>
+    class Pipeline : private core::NonCopyable {
+        static_assert(sizeof...(Stages) > 0, "Pipeline en az bir aşama içermeli");
+        static_assert(FrameSamples > 0 && Channels > 0, "Çerçeve boyutu sıfır olamaz");
+
+        template <typename Stage, typename = void>
+        struct has_process_frame : std::false_type {};
+        template <typename Stage>
+        struct has_process_frame<Stage, std::void_t<decltype(std::declval<Stage&>().process_frame(std::declval<FrameContext&>()))>>
+            : std::true_type {};
+
+        template <typename Stage, typename = void>
+        struct has_process_sample : std::false_type {};
+        template <typename Stage>
+        struct has_process_sample<Stage, std::void_t<decltype(std::declval<Stage&>().process_sample(0.0f))>>
+            : std::true_type {};
+
+        template <typename Stage, typename = void>
+        struct has_observe_sample : std::false_type {};
+        template <typename Stage>
+        struct has_observe_sample<Stage, std::void_t<decltype(std::declval<Stage&>().observe_sample(0.0f))>>
+            : std::true_type {};
+
+        template <typename Stage, typename = void>
+        struct has_begin_frame : std::false_type {};
+        template <typename Stage>
+        struct has_begin_frame<Stage, std::void_t<decltype(std::declval<Stage&>().begin_frame(std::declval<FrameContext&>()))>>
+            : std::true_type {};
+
+        template <typename Stage, typename = void>
+        struct has_end_frame : std::false_type {};
+        template <typename Stage>
+        struct has_end_frame<Stage, std::void_t<decltype(std::declval<Stage&>().end_frame(std::declval<FrameContext&>()))>>
+            : std::true_type {};
+
+        template <typename Stage>
+        static constexpr bool is_sample_stage = has_process_sample<Stage>::value || has_observe_sample<Stage>::value;
+
+        static_assert(((has_process_frame<Stages>::value || is_sample_stage<Stages>) && ...),
+                      "Her aşama process_frame, process_sample ya da observe_sample tanımlamalı");
+        static_assert(((!has_process_frame<Stages>::value || !is_sample_stage<Stages>) && ...),
+                      "Bir aşama hem blok hem örnek aşaması olamaz");
+
+        using StageTuple = std::tuple<Stages...>;
+        template <size_t I>
+        using StageAt = std::tuple_element_t<I, StageTuple>;
+
+        // I'den başlayan ardışık örnek aşamalarının bittiği (ilk blok aşaması) indeks
+        template <size_t I>
+        static constexpr size_t group_end() {
+            if constexpr (I < sizeof...(Stages)) {
+                if constexpr (is_sample_stage<StageAt<I>>) {
+                    return group_end<I + 1>();
+                } else {
+                    return I;
+                }
+            } else {
+                return I;
+            }
+        }
+
+    public:
+        static constexpr size_t FRAME_SAMPLES = FrameSamples;
+        static constexpr size_t CHANNELS = Channels;
+        static constexpr size_t FRAME_SIZE = FrameSamples * Channels;   // Ara örneklenmiş toplam örnek
+        static constexpr size_t STAGE_COUNT = sizeof...(Stages);
+
+        Pipeline() = default;
+        explicit Pipeline(const typename Stages::Config&... configs) : stages_(configs...) {}
+
+        // Çerçeve FRAME_SIZE örnek olmalıdır (aksi halde dokunulmaz ve false döner).
+        // Dönen değer VAD kararıdır (VAD aşaması yoksa true).
+        bool process(AudioFrame& frame) {
+            return process(frame, [](size_t) {});
+        }
+        // Ölçüm için: her geçiş (blok aşaması ya da birleştirilmiş örnek grubu) bittiğinde
+        // on_pass(geçişin ilk aşamasının indeksi) çağrılır. Boş geri çağırma tamamen derlenip atılır.
+        template <typename OnPass>
+        bool process(AudioFrame& frame, OnPass&& on_pass) {
+            if (frame.size() != FRAME_SIZE) { return false; }
+            FrameContext context{frame};
+            run_from<0>(context, on_pass);
+            return context.voice;
+        }
+
+        template <size_t I>
+        StageAt<I>& stage() { return std::get<I>(stages_); }
+        template <size_t I>
+        const StageAt<I>& stage() const { return std::get<I>(stages_); }
+        // Tipe göre erişim (tip zincirde bir kez geçmeli)
+        template <typename Stage>
+        Stage& stage() { return std::get<Stage>(stages_); }
+        template <typename Stage>
+        const Stage& stage() const { return std::get<Stage>(stages_); }
+
+        // Çerçeve başına örnek döngüsü sayısı (birleştirilmiş grup + blok aşaması)
+        static constexpr size_t pass_count() { return count_passes<0>(); }
+
+    private:
+        template <size_t I>
+        static constexpr size_t count_passes() {
+            if constexpr (I < sizeof...(Stages)) {
+                if constexpr (is_sample_stage<StageAt<I>>) {
+                    return 1 + count_passes<group_end<I>()>();
+                } else {
+                    return 1 + count_passes<I + 1>();
+                }
+            } else {
+                return 0;
+            }
+        }
+
+        template <size_t I, typename OnPass>
+        void run_from(FrameContext& context, OnPass& on_pass) {
+            if constexpr (I < sizeof...(Stages)) {
+                if constexpr (is_sample_stage<StageAt<I>>) {
+                    constexpr size_t end = group_end<I>();
+                    run_fused<I>(context, std::make_index_sequence<end - I>{});
+                    on_pass(I);
+                    run_from<end>(context, on_pass);
+                } else {
+                    std::get<I>(stages_).process_frame(context);
+                    on_pass(I);
+                    run_from<I + 1>(context, on_pass);
+                }
+            }
+        }
+
+        template <size_t Begin, size_t... Offsets>
+        void run_fused(FrameContext& context, std::index_sequence<Offsets...>) {
+            constexpr bool writes = (has_process_sample<StageAt<Begin + Offsets>>::value || ...);
+            (begin_stage<Begin + Offsets>(context), ...);
+            if constexpr (writes) {
+                int16_t* samples = context.frame.mutable_data();
+                for (size_t i = 0; i < FRAME_SIZE; ++i) {
+                    float value = static_cast<float>(samples[i]);
+                    ((value = sample_stage<Begin + Offsets>(value)), ...);
+                    samples[i] = static_cast<int16_t>(std::lrintf(std::clamp(value, -32768.0f, 32767.0f)));
+                }
+            } else {
+                const int16_t* samples = context.frame.data();
+                for (size_t i = 0; i < FRAME_SIZE; ++i) {
+                    const float value = static_cast<float>(samples[i]);
+                    (sample_stage<Begin + Offsets>(value), ...);
+                }
+            }
+            (end_stage<Begin + Offsets>(context), ...);
+        }
+
+        template <size_t I>
+        void begin_stage(FrameContext& context) {
+            if constexpr (has_begin_frame<StageAt<I>>::value) { std::get<I>(stages_).begin_frame(context); }
+        }
+
+        template <size_t I>
+        void end_stage(FrameContext& context) {
+            if constexpr (has_end_frame<StageAt<I>>::value) { std::get<I>(stages_).end_frame(context); }
+        }
+
+        template <size_t I>
+        float sample_stage(float value) {
+            if constexpr (has_process_sample<StageAt<I>>::value) {
+                return std::get<I>(stages_).process_sample(value);
+            } else {
+                std::get<I>(stages_).observe_sample(value);
+                return value;
+            }
+        }
+
+        StageTuple stages_;
+    };
+}
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef VOICE_ENGINE_PIPELINE_STAGES_HPP
+#define VOICE_ENGINE_PIPELINE_STAGES_HPP
+
+#include "processing/pipeline.hpp"
+#include "processing/echo_canceller.hpp"
+#include "processing/noise_suppressor.hpp"
+#include "processing/voice_activity_detector.hpp"
+#include "processing/audio_gain_controller.hpp"
+#include <cstdint>
+#include <cstddef>
+
+namespace processing {
+    // Pipeline aşamaları: mevcut işleyicileri sahiplenir (değer olarak) ve kancalarını sunar.
+
+    // Blok aşaması: bölümlenmiş FFT yankı giderici kendi 128'lik bloklarını dolaşır
+    class EchoCancellerStage {
+    public:
+        struct Config {
+            int tail_length_ms = 256;
+            int sample_rate = 48000;
+        };
+
+        EchoCancellerStage();
+        explicit EchoCancellerStage(const Config& config);
+
+        void process_frame(FrameContext& context) { canceller_.process(context.frame); }
+        // Oynatma thread'inden: uzak uç referansı
+        void on_playback(const int16_t* samples, size_t count) { canceller_.on_playback(samples, count); }
+        EchoCanceller& canceller() { return canceller_; }
+
+    private:
+        EchoCanceller canceller_;
+    };
+
+    // Blok aşaması: spektral motor STFT ile, kapı motoru çerçeve RMS'iyle çalışır
+    class NoiseSuppressorStage {
+    public:
+        struct Config {
+            NoiseSuppressor::Engine engine = NoiseSuppressor::Engine::Spectral;
+        };
+
+        NoiseSuppressorStage();
+        explicit NoiseSuppressorStage(const Config& config);
+
+        void process_frame(FrameContext& context) { suppressor_.process(context.frame); }
+        NoiseSuppressor& suppressor() { return suppressor_; }
+
+    private:
+        NoiseSuppressor suppressor_;
+    };
+
+    // Blok aşaması (salt okunur): karar çerçevenin önbellekli enerji/ZCR değerlerinden (SIMD
+    // çekirdekleri) verilir ve FrameContext::voice'a yazılır
+    class VoiceActivityStage {
+    public:
+        struct Config {
+            float energy_threshold = 2000.0f;
+            float zero_crossing_threshold = 0.3f;
+            int min_speech_frames = 3;
+            int min_silence_frames = 5;
+        };
+
+        VoiceActivityStage();
+        explicit VoiceActivityStage(const Config& config);
+
+        void process_frame(FrameContext& context) { context.voice = detector_.detect_voice(context.frame); }
+        VoiceActivityDetector& detector() { return detector_; }
+
+    private:
+        VoiceActivityDetector detector_;
+    };
+
+    // Blok aşaması: AGC + ileri bakışlı sınırlayıcı. Sınırlayıcı gelecek örneklere baktığı için
+    // örnek döngüsüne katılamaz; çıkış AudioGainController::LOOKAHEAD örnek gecikir.
+    class GainStage {
+    public:
+        using Config = AudioGainController::Config;
+
+        GainStage();
+        explicit GainStage(const Config& config);
+
+        void process_frame(FrameContext& context) { controller_.process(context.frame); }
+        AudioGainController& controller() { return controller_; }
+        const AudioGainController& controller() const { return controller_; }
+
+    private:
+        AudioGainController controller_;
+    };
+}
+
+#endif
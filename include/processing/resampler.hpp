@@ -0,0 +1,45 @@
+#ifndef VOICE_ENGINE_RESAMPLER_HPP
+#define VOICE_ENGINE_RESAMPLER_HPP
+
+#include "core/aligned_buffer.hpp"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace processing {
+    // 1.0'a yakın oranlar için kesirli örnek hızı dönüştürücü (saat kayması telafisi).
+    // Kaiser pencereli sinc, PHASES fazlı polyphase tablo; ara fazlar komşu iki fazın
+    // çıktısı arasında doğrusal kestirilir. Her çıkış örneği iki TAPS uzunluklu int16 iç
+    // çarpımdır (dsp_kernels: SSE2/AVX2). Oran blok sınırlarında kesintisiz değişebilir.
+    class FractionalResampler {
+    public:
+        static constexpr size_t TAPS = 32;
+        static constexpr size_t PHASES = 64;
+        static constexpr double MAX_DEVIATION = 0.01;   // Oran 1 ± %1 ile sınırlı
+        // Giriş ile çıkış arasındaki sabit gecikme (örnek)
+        static constexpr size_t DELAY = TAPS / 2;
+
+        FractionalResampler();
+
+        // Çıkış/giriş örnek oranı: 1'den büyükse örnek eklenir (tampon yavaş dolar)
+        void set_ratio(double ratio);
+        double ratio() const { return ratio_; }
+
+        // count girişten üretilebilecek en fazla çıkış
+        static size_t max_output(size_t count) {
+            return static_cast<size_t>(static_cast<double>(count) * (1.0 + MAX_DEVIATION)) + 2;
+        }
+        // Girişin tamamını tüketir; output en az max_output(count) yer içermeli. Üretilen sayı döner.
+        size_t process(const int16_t* input, size_t count, int16_t* output);
+        void reset();
+
+    private:
+        core::AlignedBuffer<int16_t> coefficients_;   // (PHASES + 1) x TAPS, Q15; son satır bir örnek kaymış faz 0
+        std::vector<int16_t> work_;                   // Son TAPS giriş örneği + yeni blok
+        double position_ = 0.0;                       // Sonraki çıkışın zamanı, yeni bloğun ilk örneğine göre
+        double step_ = 1.0;
+        double ratio_ = 1.0;
+    };
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef VOICE_ENGINE_SPECTRAL_NOISE_SUPPRESSOR_HPP
+#define VOICE_ENGINE_SPECTRAL_NOISE_SUPPRESSOR_HPP
+
+#include "core/aligned_buffer.hpp"
+#include "processing/fft.hpp"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace processing {
+    // Spektral Wiener gürültü bastırıcı.
+    // 480 örneklik hop, 960 örneklik sqrt-Hann analiz/sentez penceresi (%50 örtüşme) ve
+    // 1024 noktalı FFT ile overlap-add. Gürültü spektrumu minimum istatistik yöntemiyle
+    // (yumuşatılmış periodogramın alt pencerelerdeki minimumu) konuşma sırasında da izlenir;
+    // kazanç decision-directed a priori SNR ile hesaplanır ve min_gain ile tabanlanır.
+    // Overlap-add nedeniyle çıkış girişe göre HOP_SIZE örnek gecikir; hop'a hizalı olmayan
+    // çerçeve boyutlarında ilk çağrıda bir kez sessizlik eklenir ve gecikme en fazla 2 hop olur.
+    class SpectralNoiseSuppressor {
+    public:
+        static constexpr size_t HOP_SIZE = 480;
+        static constexpr size_t WINDOW_SIZE = HOP_SIZE * 2;
+        static constexpr size_t FFT_SIZE = 1024;
+        static constexpr size_t BINS = FFT_SIZE / 2 + 1;
+
+        struct Config {
+            float min_gain = 0.1f;              // Kazanç tabanı (-20 dB), müzikal gürültüyü sınırlar
+            float prior_smoothing = 0.98f;      // Decision-directed a priori SNR katsayısı
+            float power_smoothing = 0.8f;       // Periodogram yumuşatma katsayısı
+            size_t subwindow_frames = 25;       // Alt pencere uzunluğu (hop)
+            size_t subwindow_count = 6;         // Minimum arama penceresi = 6 x 25 hop = 1.5 s
+            float noise_bias = 1.8f;            // Minimumun ortalamaya göre düşük kalmasını telafi eder
+        };
+
+        SpectralNoiseSuppressor();
+        explicit SpectralNoiseSuppressor(const Config& config);
+
+        void process(std::vector<int16_t>& samples);
+        void process(int16_t* samples, size_t count);
+
+        size_t latency_samples() const { return HOP_SIZE + latency_padding_; }
+
+    private:
+        void process_hop();
+        void update_noise_estimate();
+
+        const Config config_;
+        RealFft fft_;
+
+        core::AlignedBuffer<float> window_;
+        core::AlignedBuffer<float> frame_;          // Son iki hop (analiz penceresi girişi)
+        core::AlignedBuffer<float> time_buffer_;    // FFT_SIZE, sıfır dolgulu
+        core::AlignedBuffer<float> overlap_;        // Bir önceki sentezin ikinci yarısı
+        core::AlignedBuffer<float> spectrum_re_;
+        core::AlignedBuffer<float> spectrum_im_;
+        core::AlignedBuffer<float> power_;          // |Y|^2
+        core::AlignedBuffer<float> smoothed_power_;
+        core::AlignedBuffer<float> noise_power_;
+        core::AlignedBuffer<float> current_min_;
+        core::AlignedBuffer<float> subwindow_min_;  // subwindow_count x BINS
+        core::AlignedBuffer<float> prev_clean_snr_; // G^2 * gamma (önceki hop)
+        core::AlignedBuffer<float> gain_;
+
+        core::AlignedBuffer<float> in_block_;
+        size_t block_fill_ = 0;
+        // Çıkış halkası: işlenmiş hop'lar buraya eklenir, process() çağrı boyu kadar okur
+        core::AlignedBuffer<int16_t> out_ring_;
+        size_t out_read_ = 0;
+        size_t out_size_ = 0;
+        size_t latency_padding_ = 0;
+
+        size_t frame_count_ = 0;
+        size_t subwindow_index_ = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef VOICE_ENGINE_TIME_SCALE_MODIFIER_HPP
+#define VOICE_ENGINE_TIME_SCALE_MODIFIER_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace processing {
+    // Perdeyi koruyan zaman ölçekleme (WSOLA'nın tek periyotluk biçimi). Hızlandırmada blok
+    // içinde en benzer iki ardışık perde periyodu bulunup çapraz geçişle bire indirilir;
+    // yavaşlatmada daha önce verilen çıkışın son periyodu bloğun başıyla çapraz geçişle
+    // tekrarlanır. Benzerlik normalize çapraz korelasyonla (dsp_kernels iç çarpımı) ölçülür;
+    // yeterince periyodik olmayan blok (ünsüz, geçiş) değiştirilmeden geçer, böylece hece
+    // kesilmez ve tık oluşmaz. Bloklar arasında gecikme eklemez; üretici thread'inde çalışır.
+    class TimeScaleModifier {
+    public:
+        static constexpr size_t MIN_PERIOD = 120;   // 2.5 ms @ 48 kHz (400 Hz)
+        static constexpr size_t MAX_PERIOD = 720;   // 15 ms (~67 Hz)
+        static constexpr size_t MIN_OVERLAP = 96;   // Hızlandırmada en kısa çapraz geçiş (2 ms)
+        static constexpr float MIN_CORRELATION = 0.6f;
+
+        enum class Mode { Normal, Accelerate, Expand };
+
+        struct Stats {
+            uint64_t accelerated = 0;       // Periyot çıkarılan blok
+            uint64_t expanded = 0;          // Periyot eklenen blok
+            uint64_t rejected = 0;          // Periyodik bulunmadığı için değiştirilmeyen blok
+            uint64_t removed_samples = 0;
+            uint64_t inserted_samples = 0;
+        };
+
+        TimeScaleModifier();
+
+        static size_t max_output(size_t count) { return count + MAX_PERIOD; }
+        // output en az max_output(count) yer içermeli; üretilen örnek sayısı döner.
+        // Accelerate en fazla bir periyot çıkarır, Expand en fazla bir periyot ekler.
+        size_t process(const int16_t* input, size_t count, Mode mode, int16_t* output);
+        // Akış kesildiğinde (underrun, sessizlik): eski çıkış yavaşlatmada tekrar edilmesin
+        void reset();
+        const Stats& stats() const { return stats_; }
+
+    private:
+        // En yüksek normalize korelasyonu veren periyot; uygun periyot yoksa 0
+        size_t best_accelerate_lag(const int16_t* input, size_t count, float& correlation) const;
+        size_t best_expand_lag(const int16_t* input, size_t count, float& correlation) const;
+        void remember(const int16_t* output, size_t count);
+
+        std::vector<int16_t> history_;   // Son verilen MAX_PERIOD çıkış örneği (kronolojik)
+        size_t history_size_ = 0;
+        Stats stats_;
+    };
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef VOICE_ENGINE_VOICE_ACTIVITY_DETECTOR_HPP
 #define VOICE_ENGINE_VOICE_ACTIVITY_DETECTOR_HPP
 
+#include "processing/audio_frame.hpp"
 #include <vector>
 #include <cstdint>
 
@@ -15,12 +16,15 @@ namespace processing {
         );
         
         bool detect_voice(const std::vector<int16_t>& samples);
+        // Çerçevenin önbellekli enerji/ZCR değerlerini kullanır
+        bool detect_voice(const AudioFrame& frame);
         bool is_voice_active() const { return is_voice_active_; }
         void reset();
         
     private:
         float calculate_energy(const std::vector<int16_t>& samples);
         float calculate_zero_crossing_rate(const std::vector<int16_t>& samples);
+        bool update(float current_energy, float zcr);
         
         float energy_threshold_;
         float zero_crossing_threshold_;
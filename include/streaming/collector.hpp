@@ -5,22 +5,77 @@
 #include <vector>
 #include <functional>
 #include <memory>
+#include <chrono>
+#include <cstdint>
 
 namespace streaming {
+    // Adaptif jitter buffer: sabit slot dizisi (sequence % SLOT_COUNT), ölçülen
+    // varış jitter'ına göre hesaplanan oynatma deadline'ı ve kayıp çerçeveler için gizleme.
+    // Hattaki 16 bit RTP sequence numaraları burada 32 bite genişletilir; medya zamanı
+    // RTP timestamp'inden alınır, SSRC değişimi yeni akış olarak ele alınır.
     class Collector {
     public:
+        using Clock = std::chrono::steady_clock;
         using OnDataCollected = std::function<void(const std::vector<uint8_t>&)>;
+        // Deadline'ı kaçan çerçeve için çağrılır. next_data bir sonraki paket elimizdeyse
+        // onun verisidir (Opus in-band FEC için), değilse boştur (PLC).
+        using OnDataLost = std::function<void(const std::vector<uint8_t>& next_data)>;
+        // Sırası gelen SID (PAYLOAD_TYPE_CN) paketi için çağrılır: gönderen sessizlikte, alıcı konfor
+        // gürültüsü üretmelidir. Sessizlik sırasındaki sequence boşlukları kayıp sayılmaz (gizlenmez).
+        using OnSilence = std::function<void(const std::vector<uint8_t>& sid_payload)>;
+
+        static constexpr size_t SLOT_COUNT = 64;
+        static constexpr size_t MAX_PAYLOAD_SIZE = 1500;
+
+        struct Config {
+            uint32_t clock_rate = 48000;                     // RTP timestamp saat hızı (Hz)
+            std::chrono::microseconds min_delay{5000};       // Deadline için alt sınır
+            std::chrono::microseconds max_delay{200000};     // Deadline için üst sınır
+            float jitter_multiplier = 3.0f;                  // target_delay = k * jitter
+            uint32_t max_conceal_run = 5;                    // Üst üste gizlenecek en fazla çerçeve
+        };
+
+        struct Stats {
+            uint64_t received = 0;   // Kabul edilen paketler
+            uint64_t released = 0;   // Sırasıyla çıkarılan paketler
+            uint64_t concealed = 0;  // PLC/FEC ile gizlenen çerçeveler
+            uint64_t skipped = 0;    // Gizleme sınırını aştığı için atlanan çerçeveler
+            uint64_t late = 0;       // Deadline sonrası gelip atılan paketler
+            uint64_t duplicates = 0; // Tekrar eden paketler
+            uint64_t resets = 0;     // Büyük sequence sıçraması nedeniyle yeniden senkronizasyon
+            uint64_t silence_updates = 0; // Çıkarılan SID paketleri
+            uint64_t silence_gaps = 0;    // Sessizlik sırasında kaybolup gizlenmeden geçilen paketler
+            double jitter_ms = 0.0;
+            double target_delay_ms = 0.0;
+            uint32_t ssrc = 0;             // Takip edilen akış
+            uint32_t highest_sequence = 0; // 32 bite genişletilmiş en yüksek sequence (geri bildirim için)
+        };
 
         Collector();
+        explicit Collector(const Config& config);
         ~Collector();
-        
+
         void collect(const core::Packet& packet, const OnDataCollected& callback);
+        // Kopyasız yol: payload doğrudan alım tamponundan slot'a kopyalanır.
+        void collect(const core::PacketView& packet, const OnDataCollected& callback);
+        // Süresi dolan çerçeveleri paket gelmese de gizler. collect yalnızca paket geldiğinde çalıştığı
+        // için konuşma sonundaki kayıplar ancak poll ile gizlenir: sahibi bunu periyodik olarak
+        // (jitter buffer hedef gecikmesinden sık) çağırmalıdır. Application olay döngüsü zamanlayıcısıyla,
+        // MixerServer her mix tick'inde, netsim sanal saat adımında çağırır.
+        void poll(const OnDataCollected& callback);
+        // Zamanı dışarıdan verilen sürümler: simülasyon ve ölçümde sanal saat ile
+        // tekrarlanabilir davranış için. Aynı Collector'da saat kaynakları karıştırılmamalıdır.
+        void collect(const core::PacketView& packet, const OnDataCollected& callback, Clock::time_point arrival);
+        void poll(const OnDataCollected& callback, Clock::time_point now);
+        void set_loss_callback(OnDataLost callback);
+        void set_silence_callback(OnSilence callback);
         void reset();
-        
+        Stats get_stats() const;
+
     private:
         class Impl;
         std::unique_ptr<Impl> impl_;
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,79 @@
+#ifndef VOICE_ENGINE_FEEDBACK_HPP
+#define VOICE_ENGINE_FEEDBACK_HPP
+
+#include "core/feedback_report.hpp"
+#include "codec/opus_codec.hpp"
+#include "streaming/collector.hpp"
+#include <chrono>
+#include <cstdint>
+
+namespace streaming {
+    // Alıcı tarafı: Collector istatistiklerinden periyodik geri bildirim raporu üretir.
+    // Kayıp oranı RTCP'deki gibi aralık başına beklenen/alınan paket farkından hesaplanır;
+    // deadline'ı kaçıran (geç) paketler alınmış sayılır, tekrarlar sayılmaz.
+    class FeedbackReporter {
+    public:
+        using Clock = Collector::Clock;
+
+        struct Config {
+            std::chrono::milliseconds interval{500};
+            uint32_t clock_rate = 48000;     // Jitter'ın RTP timestamp birimine çevrimi için
+        };
+
+        FeedbackReporter();
+        explicit FeedbackReporter(const Config& config);
+
+        bool is_due(Clock::time_point now) const { return !has_reported_ || now >= next_report_; }
+        std::chrono::milliseconds interval() const { return config_.interval; }
+        // Zamanlayıcıyı ilerletir; akış yoksa (SSRC 0 / hiç paket) veya aralıkta yeni sequence
+        // gelmediyse (sessizlik, yeni akışın taban çizgisi) rapor üretmez ve false döner
+        bool make_report(const Collector::Stats& stats, Clock::time_point now, core::FeedbackReport& report);
+
+    private:
+        const Config config_;
+        bool has_reported_ = false;
+        Clock::time_point next_report_{};
+
+        bool has_baseline_ = false;
+        uint32_t base_ssrc_ = 0;
+        uint64_t base_resets_ = 0;
+        uint32_t last_highest_ = 0;
+        uint64_t last_received_ = 0;
+        uint32_t cumulative_lost_ = 0;
+    };
+
+    // Gönderici tarafı: raporlara göre bitrate, in-band FEC ve beklenen kayıp yüzdesini ayarlar.
+    // Kayıp düşükken bitrate yavaşça artar, yüksekken kayıpla orantılı azalır (kayıp tabanlı
+    // kontrol); FEC histerezisle açılıp kapanır ve açıkken FEC payı için alt bitrate korunur.
+    class RateController {
+    public:
+        struct Config {
+            int min_bitrate = 16000;
+            int max_bitrate = 64000;
+            double increase_factor = 1.05;        // Temiz raporda çarpımsal artış
+            double low_loss = 0.02;               // Altında bitrate artırılır
+            double high_loss = 0.10;              // Üstünde bitrate azaltılır
+            double fec_on_loss = 0.01;            // Ortalama kayıp bunu aşınca FEC açılır
+            double fec_off_loss = 0.003;          // Bunun altına inince kapanır
+            int fec_min_bitrate = 24000;          // FEC açıkken inilecek en düşük bitrate
+            int max_expected_loss_percent = 30;
+            double loss_smoothing = 0.7;          // Üstel ortalama katsayısı (eski değerin ağırlığı)
+        };
+
+        RateController();
+        RateController(const Config& config, const codec::EncoderSettings& initial);
+
+        // Ayar değiştiyse true döner ve settings güncellenir
+        bool on_feedback(const core::FeedbackReport& report, codec::EncoderSettings& settings);
+        const codec::EncoderSettings& settings() const { return settings_; }
+        double smoothed_loss() const { return smoothed_loss_; }
+
+    private:
+        const Config config_;
+        codec::EncoderSettings settings_;
+        double smoothed_loss_ = 0.0;
+        bool has_loss_ = false;
+    };
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef VOICE_ENGINE_FRAME_ACCUMULATOR_HPP
+#define VOICE_ENGINE_FRAME_ACCUMULATOR_HPP
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+namespace streaming {
+    // Aygıt çerçevelerini (10ms) paketleme süresi (ptime) kadar biriktirir. Yakalama ve DSP
+    // 10ms adımla çalışmaya devam eder; encode/gönderim paket dolduğunda bir kez yapılır.
+    // Paketin RTP timestamp'i ilk çerçevenin, ses bilgisi herhangi bir çerçevede ses olup olmadığıdır.
+    class FrameAccumulator {
+    public:
+        FrameAccumulator(size_t frame_samples, size_t frames_per_packet)
+            : frame_samples_(frame_samples), frames_per_packet_(std::max<size_t>(1, frames_per_packet)) {
+            samples_.reserve(frame_samples_ * frames_per_packet_);
+        }
+
+        // Çerçeveyi ekler; paket dolduysa true döner (clear() çağrılana kadar yeni çerçeve eklenmemeli)
+        bool push(const int16_t* samples, size_t count, uint32_t timestamp, bool voice) {
+            if (frames_ == 0) {
+                timestamp_ = timestamp;
+                has_voice_ = false;
+            }
+            samples_.insert(samples_.end(), samples, samples + std::min(count, frame_samples_));
+            has_voice_ = has_voice_ || voice;
+            ++frames_;
+            return full();
+        }
+
+        bool full() const { return frames_ >= frames_per_packet_; }
+        void clear() {
+            samples_.clear();
+            frames_ = 0;
+        }
+
+        const int16_t* data() const { return samples_.data(); }
+        size_t size() const { return samples_.size(); }
+        size_t frames() const { return frames_; }
+        size_t frames_per_packet() const { return frames_per_packet_; }
+        uint32_t timestamp() const { return timestamp_; }
+        bool has_voice() const { return has_voice_; }
+
+    private:
+        const size_t frame_samples_;
+        const size_t frames_per_packet_;
+        std::vector<int16_t> samples_;
+        size_t frames_ = 0;
+        uint32_t timestamp_ = 0;
+        bool has_voice_ = false;
+    };
+}
+
+#endif
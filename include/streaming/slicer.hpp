@@ -5,35 +5,60 @@
 #include <vector>
 #include <cstdint>
 #include <atomic>
+#include <random>
 #include <algorithm> // For std::min
+#include <utility>
 
 namespace streaming {
     class Slicer {
     public:
-        Slicer() : sequence_number_(0) {}
+        Slicer() : sequence_number_(0), ssrc_(std::random_device{}()) {}
+        explicit Slicer(uint32_t ssrc) : sequence_number_(0), ssrc_(ssrc) {}
 
-        std::vector<core::Packet> slice(const std::vector<uint8_t>& data, size_t max_slice_size) {
+        uint32_t ssrc() const { return ssrc_; }
+
+        std::vector<core::Packet> slice(const std::vector<uint8_t>& data, size_t max_slice_size,
+                                        uint32_t timestamp = 0, bool marker = false) {
+            return slice(data.data(), data.size(), max_slice_size, timestamp, marker);
+        }
+
+        std::vector<core::Packet> slice(const uint8_t* data, size_t size, size_t max_slice_size,
+                                        uint32_t timestamp = 0, bool marker = false) {
             std::vector<core::Packet> packets;
-            if (data.empty()) {
-                return packets;
+            std::vector<core::PacketView> views;
+            slice(data, size, max_slice_size, timestamp, marker, views);
+            packets.reserve(views.size());
+            for (const auto& view : views) {
+                packets.push_back(core::Packet::from_view(view));
             }
+            return packets;
+        }
 
-            for (size_t i = 0; i < data.size(); i += max_slice_size) {
-                core::Packet packet;
-                packet.sequence_number = sequence_number_++;
-
-                auto start = data.begin() + i;
-                auto end = start + std::min(max_slice_size, data.size() - i);
-                packet.data.assign(start, end);
+        // Kopyasız yol: out, data içine işaret eden görünümlerle doldurulur (out yeniden kullanılır).
+        // Aynı çerçevenin tüm parçaları aynı timestamp'i taşır; marker yalnızca ilk parçada olur.
+        void slice(const uint8_t* data, size_t size, size_t max_slice_size,
+                   uint32_t timestamp, bool marker, std::vector<core::PacketView>& out) {
+            out.clear();
+            if (!data || size == 0 || max_slice_size == 0) {
+                return;
+            }
 
-                packets.push_back(packet);
+            for (size_t i = 0; i < size; i += max_slice_size) {
+                core::PacketView view;
+                view.sequence_number = sequence_number_++;
+                view.timestamp = timestamp;
+                view.ssrc = ssrc_;
+                view.marker = marker && i == 0;
+                view.payload = data + i;
+                view.payload_size = std::min(max_slice_size, size - i);
+                out.push_back(view);
             }
-            return packets;
         }
 
     private:
         std::atomic<uint32_t> sequence_number_;
+        const uint32_t ssrc_;
     };
 }
 
-#endif
\ No newline at end of file
+#endif
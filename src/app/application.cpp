@@ -1,21 +1,50 @@
 #include "app/application.hpp"
 #include <iostream>
+#include <sstream>
+#include <algorithm>
 
 namespace app {
-Application::Application() {
+Application::Application() : Application(Config{}) {}
+
+Application::Application(const Config& config)
+    : config_(config),
+      accumulator_(FRAME_SAMPLES, static_cast<size_t>(std::max(1, config.ptime_ms / 10))) {
     try {
+        event_loop_      = std::make_unique<network::EventLoop>();
         capturer_        = std::make_unique<capture::AudioCapturer>();
-        codec_           = std::make_unique<codec::OpusCodec>();
+        codec_           = std::make_unique<codec::OpusCodec>(capture::AudioCapturer::SAMPLE_RATE,
+                                                              capture::AudioCapturer::NUM_CHANNELS, config_.ptime_ms);
         slicer_          = std::make_unique<streaming::Slicer>();
         sender_          = std::make_unique<network::UdpSender>();
-        receiver_        = std::make_unique<network::UdpReceiver>();
+        feedback_sender_ = std::make_unique<network::UdpSender>();
+        receiver_        = std::make_unique<network::UdpReceiver>(event_loop_.get());
+        sender_->set_backend(config_.io_backend);
+        feedback_sender_->set_backend(config_.io_backend);
+        receiver_->set_backend(config_.io_backend);
+        event_loop_->set_thread_tuning(config_.realtime.network, "voice-loop");
+        capturer_->set_thread_tuning(config_.realtime.processing);
         collector_       = std::make_unique<streaming::Collector>();
         player_          = std::make_unique<playback::AudioPlayer>();
-        echo_canceller_  = std::make_unique<processing::EchoCanceller>();
-        noise_suppressor_= std::make_unique<processing::NoiseSuppressor>();
-        vad_             = std::make_unique<processing::VoiceActivityDetector>();
+        // Kayma telafisi hedefi: bir paket süresi + bir callback periyodu (daha azı her pakette underrun riski)
+        player_->set_target_buffer(static_cast<size_t>(config_.ptime_ms) * playback::AudioPlayer::SAMPLE_RATE / 1000
+                                   + playback::AudioPlayer::FRAMES_PER_BUFFER);
+        if (config_.playout_agc) {
+            playout_agc_ = std::make_unique<processing::AudioGainController>();
+        }
+        capture_frame_ = processing::AudioFrame(FRAME_SAMPLES);
+        encode_buffer_.resize(codec::OpusCodec::MAX_PACKET_SIZE);
+        decode_buffer_.resize(codec_->max_decoded_samples());
+        outgoing_packets_.reserve(network::UdpSender::BATCH_SIZE);
+        feedback_buffer_.resize(core::RTP_HEADER_SIZE + core::FeedbackReport::SERIALIZED_SIZE);
+        on_collected_ = [this](const std::vector<uint8_t>& payload) { on_audio_collected(payload); };
+        collector_->set_loss_callback([this](const std::vector<uint8_t>& next_data) {
+            on_audio_lost(next_data);
+        });
+        collector_->set_silence_callback([this](const std::vector<uint8_t>& sid_payload) {
+            on_silence(sid_payload);
+        });
         player_->set_playback_callback([this](const std::vector<int16_t>& data){
-            echo_canceller_->on_playback(data);
+            capture_pipeline_.stage<processing::EchoCancellerStage>().on_playback(data.data(), data.size());
         });
     } catch (const std::exception& e) {
         std::cerr << "Uygulama başlatılırken kritik hata: " << e.what() << std::endl;
@@ -27,76 +56,327 @@ Application::~Application() {
     std::cout << "Uygulama sonlandırılıyor." << std::endl;
 }
 
+void Application::enable_stats(const network::StatsEndpoint::Config& config) {
+    stats_endpoint_ = std::make_unique<network::StatsEndpoint>(config);
+}
+
 void Application::run(const std::string& target_ip, int send_port, int listen_port) {
+    // Tamponlar ayrıldı, thread'ler henüz yok: hepsi kilitlenip sayfalanır
+    if (config_.realtime.lock_memory) {
+        core::lock_process_memory();
+    }
+    if (!event_loop_->start()) { std::cerr << "HATA: Olay döngüsü başlatılamadı." << std::endl; return; }
     if (!sender_->connect(target_ip, send_port)) { std::cerr << "HATA: Sender bağlanamadı." << std::endl; return; }
-    auto packet_callback = [this](core::Packet packet) { this->on_packet_received(std::move(packet)); };
-    if (!receiver_->start(listen_port, packet_callback)) { std::cerr << "HATA: Receiver başlatılamadı." << std::endl; return; }
+    if (!feedback_sender_->connect(target_ip, send_port)) { std::cerr << "HATA: Geri bildirim soketi bağlanamadı." << std::endl; return; }
+    // EAGAIN'de atmak yerine kuyruğa al, soket yazılabilir olunca döngü göndersin
+    sender_->attach(event_loop_.get());
+    feedback_sender_->attach(event_loop_.get());
+    auto datagram_callback = [this](const uint8_t* data, size_t size, const sockaddr_in&) { this->on_datagram_received(data, size); };
+    if (!receiver_->start_raw(listen_port, datagram_callback)) { std::cerr << "HATA: Receiver başlatılamadı." << std::endl; return; }
     if (!player_->start()) { std::cerr << "HATA: Player başlatılamadı." << std::endl; return; }
     auto capture_callback = [this](const std::vector<int16_t>& pcm_data) { this->on_audio_captured(pcm_data); };
     if (!capturer_->start(capture_callback)) { std::cerr << "HATA: Capturer başlatılamadı." << std::endl; return; }
+    // Deadline sürücüsü: paket gelmese de (konuşma sonu kaybı) gizleme zamanında yapılır
+    event_loop_->add_timer(JITTER_POLL_INTERVAL, [this] { collector_->poll(on_collected_); }, JITTER_POLL_INTERVAL);
+    event_loop_->add_timer(feedback_reporter_.interval(), [this] { send_feedback(); }, feedback_reporter_.interval());
+    if (stats_endpoint_ && !stats_endpoint_->start([this] { return stats_json(); })) {
+        std::cerr << "UYARI: İstatistik endpoint'i başlatılamadı." << std::endl;
+        stats_endpoint_.reset();
+    }
 
     std::cout << "\n>>> Voice Engine calisiyor... <<<" << std::endl;
     std::cout << ">>> Hedef: " << target_ip << ":" << send_port << std::endl;
     std::cout << ">>> Dinlenen Port: " << listen_port << std::endl;
+    std::cout << ">>> Paketleme süresi: " << config_.ptime_ms << " ms"
+              << (config_.dtx ? " (DTX açık)" : "") << std::endl;
     std::cout << ">>> Kapatmak icin Enter'a basin. <<<" << std::endl;
     std::cin.get();
 
     capturer_->stop();
-    player_->stop();
     receiver_->stop();
+    event_loop_->stop();
+    player_->stop();
+    if (stats_endpoint_) { stats_endpoint_->stop(); }
+
+    auto playout = player_->get_stats();
+    auto capture = capturer_->get_stats();
+    auto capture_agc = capture_pipeline_.stage<processing::GainStage>().controller().get_stats();
+    std::cout << ">>> Yakalama hattı - işlenen: " << capture.frames_processed
+              << ", atılan: " << capture.frames_dropped
+              << ", input overflow: " << capture.input_overflows
+              << ", gecikme ort/max: " << capture.avg_latency_ns / 1000 << "/"
+              << capture.max_latency_ns / 1000 << " us"
+              << ", AGC kazancı: " << capture_agc.gain
+              << ", sınırlanan blok: " << capture_agc.limited_blocks
+              << std::endl;
+    auto jitter = collector_->get_stats();
+    std::cout << ">>> Jitter buffer - alınan: " << jitter.received
+              << ", gizlenen: " << jitter.concealed
+              << ", sessizlik boşluğu: " << jitter.silence_gaps
+              << ", geç kalan: " << jitter.late
+              << ", jitter: " << jitter.jitter_ms << " ms" << std::endl;
+    std::cout << ">>> Oynatma istatistikleri - underrun: " << playout.underruns
+              << ", overrun: " << playout.overruns
+              << ", atılan sample: " << playout.dropped_samples
+              << ", konfor gürültüsü: " << playout.comfort_noise_samples << " sample"
+              << ", saat kayması: " << playout.drift_ppm << " ppm"
+              << ", hızlandırma/yavaşlatma: " << playout.accelerated_samples << "/" << playout.expanded_samples
+              << " sample" << std::endl;
+    auto loop_lateness = event_loop_->wakeup_lateness();
+    auto worker_lateness = capturer_->wakeup_lateness();
+    std::cout << ">>> Uyanma gecikmesi p99/max - ağ (" << core::sched_policy_name(event_loop_->get_stats().sched_policy)
+              << "): " << loop_lateness.percentile(0.99) / 1000 << "/" << loop_lateness.max / 1000 << " us"
+              << ", işleme (" << core::sched_policy_name(capture.worker_policy) << "): "
+              << worker_lateness.percentile(0.99) / 1000 << "/" << worker_lateness.max / 1000 << " us" << std::endl;
+    auto capture_to_send = metrics_.snapshot(EngineMetrics::CAPTURE_TO_SEND);
+    std::cout << ">>> Yakalama -> gönderim p50/p99/max: " << capture_to_send.percentile(0.50) / 1000 << "/"
+              << capture_to_send.percentile(0.99) / 1000 << "/" << capture_to_send.max / 1000 << " us"
+              << ", VAD ile atılan: " << metrics_.counter(EngineMetrics::VAD_DROPPED)
+              << ", encode hatası: " << metrics_.counter(EngineMetrics::ENCODE_FAILURES) << std::endl;
+}
+
+std::string Application::stats_json() const {
+    auto capture = capturer_->get_stats();
+    auto jitter = collector_->get_stats();
+    auto playout = player_->get_stats();
+    auto encoder = codec_->settings();
+    auto media_send = sender_->get_stats();
+    auto media_receive = receiver_->get_stats();
+    auto loop = event_loop_->get_stats();
+    auto capture_agc = capture_pipeline_.stage<processing::GainStage>().controller().get_stats();
+    auto playout_agc = playout_agc_ ? playout_agc_->get_stats() : processing::AudioGainController::Stats{};
+    auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    std::ostringstream out;
+    out << "{\"timestamp_ms\":" << now_ms << "," << metrics_.to_json_fields()
+        << ",\"capture\":{\"frames_captured\":" << capture.frames_captured
+        << ",\"frames_processed\":" << capture.frames_processed
+        << ",\"frames_dropped\":" << capture.frames_dropped
+        << ",\"input_overflows\":" << capture.input_overflows
+        << ",\"queue_size\":" << capture.queue_size
+        << ",\"agc_gain\":" << capture_agc.gain
+        << ",\"limiter_gain\":" << capture_agc.limiter_gain
+        << ",\"limited_blocks\":" << capture_agc.limited_blocks << "}"
+        << ",\"jitter_buffer\":{\"received\":" << jitter.received
+        << ",\"released\":" << jitter.released
+        << ",\"concealed\":" << jitter.concealed
+        << ",\"skipped\":" << jitter.skipped
+        << ",\"late\":" << jitter.late
+        << ",\"duplicates\":" << jitter.duplicates
+        << ",\"resets\":" << jitter.resets
+        << ",\"silence_updates\":" << jitter.silence_updates
+        << ",\"silence_gaps\":" << jitter.silence_gaps
+        << ",\"jitter_ms\":" << jitter.jitter_ms
+        << ",\"target_delay_ms\":" << jitter.target_delay_ms << "}"
+        << ",\"encoder\":{\"bitrate\":" << encoder.bitrate
+        << ",\"inband_fec\":" << (encoder.inband_fec ? "true" : "false")
+        << ",\"expected_loss_percent\":" << encoder.expected_loss_percent << "}"
+        << ",\"network\":{\"rx_backend\":\"" << network::io_backend_name(receiver_->backend()) << "\""
+        << ",\"tx_backend\":\"" << network::io_backend_name(sender_->backend()) << "\""
+        << ",\"datagrams_received\":" << media_receive.datagrams
+        << ",\"receive_errors\":" << media_receive.errors
+        << ",\"datagrams_sent\":" << media_send.datagrams_sent
+        << ",\"send_queued\":" << media_send.queued
+        << ",\"send_dropped\":" << media_send.dropped
+        << ",\"send_queue_depth\":" << media_send.queue_depth
+        << ",\"loop_wakeups\":" << loop.wakeups
+        << ",\"loop_io_events\":" << loop.io_events
+        << ",\"loop_timers_fired\":" << loop.timers_fired << "}"
+        << ",\"playout\":{\"underruns\":" << playout.underruns
+        << ",\"overruns\":" << playout.overruns
+        << ",\"dropped_samples\":" << playout.dropped_samples
+        << ",\"comfort_noise_samples\":" << playout.comfort_noise_samples
+        << ",\"target_samples\":" << playout.target_samples
+        << ",\"drift_ppm\":" << playout.drift_ppm
+        << ",\"accelerated_samples\":" << playout.accelerated_samples
+        << ",\"expanded_samples\":" << playout.expanded_samples
+        << ",\"buffered_samples\":" << playout.buffered_samples
+        << ",\"agc\":" << (playout_agc_ ? "true" : "false")
+        << ",\"agc_gain\":" << playout_agc.gain
+        << ",\"limiter_gain\":" << playout_agc.limiter_gain
+        << ",\"limited_blocks\":" << playout_agc.limited_blocks << "}"
+        << ",\"threads\":{\"network\":{\"policy\":\"" << core::sched_policy_name(loop.sched_policy) << "\""
+        << ",\"wakeup_lateness_ns\":" << EngineMetrics::histogram_json(event_loop_->wakeup_lateness()) << "}"
+        << ",\"processing\":{\"policy\":\"" << core::sched_policy_name(capture.worker_policy) << "\""
+        << ",\"wakeup_lateness_ns\":" << EngineMetrics::histogram_json(capturer_->wakeup_lateness()) << "}}}";
+    return out.str();
 }
 
 void Application::on_audio_captured(const std::vector<int16_t>& pcm_data) {
-    // Frame size validation
-    if (pcm_data.size() != 480) { // 48kHz, 10ms frame
+    // Frame size validation: yakalama her zaman aygıt çerçevesi (10ms) adımıyla gelir
+    if (pcm_data.size() != FRAME_SAMPLES) {
         std::cerr << "UYARI: Geçersiz frame size: " << pcm_data.size() << std::endl;
         return;
     }
     
-    std::vector<int16_t> processed = pcm_data;
+    // RTP timestamp her yakalanan çerçevede ilerler; böylece alıcı sessizlik boşluğunu doğru ölçer
+    const auto captured_at = capturer_->frame_timestamp();
+    const auto process_start = EngineMetrics::Clock::now();
+    metrics_.record(EngineMetrics::CAPTURE_QUEUE, process_start - captured_at);
+
+    const uint32_t frame_timestamp = capture_timestamp_;
+    capture_timestamp_ += static_cast<uint32_t>(pcm_data.size() / capture::AudioCapturer::NUM_CHANNELS);
+
+    processing::AudioFrame& processed = capture_frame_;
+    processed.assign(pcm_data.data(), pcm_data.size());
     
     // Audio processing pipeline
     try {
-        // 1. Echo Cancellation (önce echo'yu temizle)
-        echo_canceller_->process(processed);
-        
-        // 2. Voice Activity Detection (ses var mı kontrol et)
-        bool voice_detected = vad_->detect_voice(processed);
+        // 1-3. Echo Cancellation -> Noise Suppression -> Voice Activity Detection -> AGC.
+        //      Spektral NS gürültü tahmini ve overlap-add durumu için kesintisiz akış ister,
+        //      bu yüzden VAD'den önce her çerçevede çalışır. AGC de sessizlikte seviye izlemeyi
+        //      ve sınırlayıcı gecikme hattını sürdürmek için her çerçevede çalışır.
+        const bool voice_detected = capture_pipeline_.process(processed);
+        const auto encode_start = EngineMetrics::Clock::now();
+        metrics_.record(EngineMetrics::PROCESS, encode_start - process_start);
         
-        if (!voice_detected) {
-            // Ses yok - gönderme (bandwidth tasarrufu + gürültü azaltma)
+        // 4. Paketleme süresi kadar biriktir; paket içinde herhangi bir çerçevede ses varsa gönderilir
+        if (!accumulator_.push(processed.data(), processed.size(), frame_timestamp, voice_detected)) {
             return;
         }
+        if (!accumulator_.has_voice()) {
+            // Ses yok - gönderme (bandwidth tasarrufu + gürültü azaltma). DTX açıksa sessizliğin
+            // başında ve her SID_INTERVAL'de arka plan seviyesi gider; alıcı boşluğu kayıp sanmaz.
+            metrics_.add(EngineMetrics::VAD_DROPPED, accumulator_.frames());
+            const uint32_t silence_timestamp = accumulator_.timestamp();
+            if (config_.dtx && (!sid_sent_ || silence_timestamp - last_sid_timestamp_ >= SID_INTERVAL)) {
+                send_silence_descriptor(silence_timestamp);
+            }
+            accumulator_.clear();
+            was_voice_active_ = false;
+            return;
+        }
+        const bool talkspurt_start = !was_voice_active_;
+        was_voice_active_ = true;
+        sid_sent_ = false;
+        const uint32_t packet_timestamp = accumulator_.timestamp();
         
-        // 3. Noise Suppression (sadece ses varken uygula)
-        noise_suppressor_->process(processed);
-        
-        // 4. Codec encoding
-        auto encoded_data = codec_->encode(processed);
-        if (encoded_data.empty()) {
+        // 5. Codec encoding
+        size_t encoded_size = codec_->encode(accumulator_.data(), accumulator_.size(),
+                                             encode_buffer_.data(), encode_buffer_.size());
+        accumulator_.clear();
+        const auto send_start = EngineMetrics::Clock::now();
+        metrics_.record(EngineMetrics::ENCODE, send_start - encode_start);
+        if (encoded_size == 0) {
+            metrics_.add(EngineMetrics::ENCODE_FAILURES);
             std::cerr << "UYARI: Codec encoding başarısız." << std::endl;
             return;
         }
         
-        // 5. Network transmission
-        auto packets = slicer_->slice(encoded_data, 1000);
-        if (!packets.empty()) {
-            sender_->send(packets);
+        // 6. Network transmission
+        slicer_->slice(encode_buffer_.data(), encoded_size, 1000, packet_timestamp, talkspurt_start, outgoing_packets_);
+        if (!outgoing_packets_.empty()) {
+            sender_->send(outgoing_packets_);
+            metrics_.add(EngineMetrics::PACKETS_SENT, outgoing_packets_.size());
         }
+        const auto sent_at = EngineMetrics::Clock::now();
+        metrics_.record(EngineMetrics::SEND, sent_at - send_start);
+        metrics_.record(EngineMetrics::CAPTURE_TO_SEND, sent_at - captured_at);
         
     } catch (const std::exception& e) {
         std::cerr << "Audio processing hatası: " << e.what() << std::endl;
     }
 }
 
-void Application::on_packet_received(core::Packet packet) {
-    auto collection_callback = [this](const std::vector<uint8_t>& data) { this->on_audio_collected(data); };
-    collector_->collect(packet, collection_callback);
+void Application::send_silence_descriptor(uint32_t timestamp) {
+    // SID: RFC 3389 gövdesinin yalnızca seviye baytı (-dBov); spektral katsayılar gönderilmez.
+    // Medya ile aynı slicer'dan geçer, böylece sequence sürekli kalır ve alıcı kaybı ayırt eder.
+    encode_buffer_[0] = processing::ComfortNoiseGenerator::level_from_samples(accumulator_.data(), accumulator_.size());
+    slicer_->slice(encode_buffer_.data(), processing::ComfortNoiseGenerator::SID_PAYLOAD_SIZE, 1000,
+                   timestamp, false, outgoing_packets_);
+    for (auto& packet : outgoing_packets_) {
+        packet.payload_type = core::PAYLOAD_TYPE_CN;
+    }
+    sender_->send(outgoing_packets_);
+    metrics_.add(EngineMetrics::SID_SENT);
+    sid_sent_ = true;
+    last_sid_timestamp_ = timestamp;
+}
+
+void Application::on_datagram_received(const uint8_t* data, size_t size) {
+    // RTP başlığı kopyasız çözülür; payload alım slotundan doğrudan jitter buffer'a gider
+    const auto received_at = EngineMetrics::Clock::now();
+    core::PacketView packet;
+    const bool parsed = core::PacketView::parse(data, size, packet);
+    if (parsed && packet.payload_type == core::PAYLOAD_TYPE_FEEDBACK) {
+        on_feedback_received(packet);
+        return;
+    }
+    if (!parsed || (packet.payload_type != core::PAYLOAD_TYPE_OPUS && packet.payload_type != core::PAYLOAD_TYPE_CN)) {
+        metrics_.add(EngineMetrics::PACKETS_REJECTED);
+        return;
+    }
+    metrics_.add(packet.payload_type == core::PAYLOAD_TYPE_CN ? EngineMetrics::SID_RECEIVED : EngineMetrics::PACKETS_RECEIVED);
+    collector_->collect(packet, on_collected_);
+    metrics_.record(EngineMetrics::RECEIVE, EngineMetrics::Clock::now() - received_at);
+}
+
+void Application::send_feedback() {
+    core::FeedbackReport report;
+    if (!feedback_reporter_.make_report(collector_->get_stats(), EngineMetrics::Clock::now(), report)) { return; }
+
+    core::PacketView packet;
+    packet.payload_type = core::PAYLOAD_TYPE_FEEDBACK;
+    packet.sequence_number = feedback_sequence_++;
+    packet.ssrc = slicer_->ssrc();
+    uint8_t payload[core::FeedbackReport::SERIALIZED_SIZE];
+    packet.payload = payload;
+    packet.payload_size = report.serialize(payload, sizeof(payload));
+    size_t size = packet.serialize(feedback_buffer_.data(), feedback_buffer_.size());
+    feedback_sender_->send_datagram(feedback_buffer_.data(), size);
+    metrics_.add(EngineMetrics::FEEDBACK_SENT);
+}
+
+void Application::on_feedback_received(const core::PacketView& packet) {
+    core::FeedbackReport report;
+    if (!core::FeedbackReport::parse(packet.payload, packet.payload_size, report)) { return; }
+    // Yalnızca bizim gönderdiğimiz akış hakkındaki raporlar
+    if (report.media_ssrc != slicer_->ssrc()) { return; }
+    metrics_.add(EngineMetrics::FEEDBACK_RECEIVED);
+
+    codec::EncoderSettings settings;
+    if (rate_controller_.on_feedback(report, settings)) {
+        codec_->apply_settings(settings);
+    }
+}
+
+void Application::on_silence(const std::vector<uint8_t>& sid_payload) {
+    // Karşı taraf sessizlikte: tampon boşaldıkça oynatıcı bu seviyede yerel gürültü üretir
+    player_->start_comfort_noise(sid_payload.empty() ? processing::ComfortNoiseGenerator::SILENCE_LEVEL : sid_payload[0]);
 }
 
 void Application::on_audio_collected(const std::vector<uint8_t>& encoded_data) {
-    auto decoded_data = codec_->decode(encoded_data);
-    if (decoded_data.empty()) return;
-    player_->submit_audio_data(decoded_data);
+    const auto decode_start = EngineMetrics::Clock::now();
+    size_t decoded_samples = codec_->decode(encoded_data.data(), encoded_data.size(),
+                                            decode_buffer_.data(), decode_buffer_.size());
+    metrics_.record(EngineMetrics::DECODE, EngineMetrics::Clock::now() - decode_start);
+    play_decoded(decoded_samples);
+    // Konfor gürültüsü konuşmanın ilk bloğu tampona girdikten sonra kapatılır: arada çalışan ses
+    // callback'i boş tampon + kapalı gürültü görüp sessizlik çalmaz ve underrun saymaz
+    player_->stop_comfort_noise();
+}
+
+void Application::on_audio_lost(const std::vector<uint8_t>& next_data) {
+    const auto decode_start = EngineMetrics::Clock::now();
+    size_t concealed_samples = codec_->decode_lost(next_data.data(), next_data.size(),
+                                                   decode_buffer_.data(), decode_buffer_.size());
+    metrics_.record(EngineMetrics::DECODE, EngineMetrics::Clock::now() - decode_start);
+    play_decoded(concealed_samples);
+}
+
+void Application::play_decoded(size_t decoded_samples) {
+    if (decoded_samples == 0) {
+        metrics_.add(EngineMetrics::DECODE_FAILURES);
+        return;
+    }
+    // Bu çerçevenin oynatılmadan önce bekleyeceği süre: tamponda önünde duran örnekler
+    const size_t queued = player_->buffered_samples();
+    metrics_.record(EngineMetrics::PLAYOUT_BUFFER,
+                    std::chrono::nanoseconds(static_cast<int64_t>(queued) * 1000000000 / playback::AudioPlayer::SAMPLE_RATE));
+    if (playout_agc_) {
+        playout_agc_->process(decode_buffer_.data(), decoded_samples);
+    }
+    player_->submit_audio_data(decode_buffer_.data(), decoded_samples);
 }
 }
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "app/engine_metrics.hpp"
+#include <sstream>
+
+namespace app {
+    const char* EngineMetrics::stage_name(Stage stage) {
+        switch (stage) {
+            case CAPTURE_QUEUE:   return "capture_queue";
+            case PROCESS:         return "process";
+            case ENCODE:          return "encode";
+            case SEND:            return "send";
+            case CAPTURE_TO_SEND: return "capture_to_send";
+            case RECEIVE:         return "receive";
+            case DECODE:          return "decode";
+            case PLAYOUT_BUFFER:  return "playout_buffer";
+            case STAGE_COUNT:     break;
+        }
+        return "?";
+    }
+
+    const char* EngineMetrics::counter_name(Counter counter) {
+        switch (counter) {
+            case PACKETS_SENT:     return "packets_sent";
+            case PACKETS_RECEIVED: return "packets_received";
+            case PACKETS_REJECTED: return "packets_rejected";
+            case VAD_DROPPED:      return "vad_dropped_frames";
+            case ENCODE_FAILURES:  return "encode_failures";
+            case DECODE_FAILURES:  return "decode_failures";
+            case FEEDBACK_SENT:    return "feedback_sent";
+            case FEEDBACK_RECEIVED: return "feedback_received";
+            case SID_SENT:         return "sid_sent";
+            case SID_RECEIVED:     return "sid_received";
+            case COUNTER_COUNT:    break;
+        }
+        return "?";
+    }
+
+    std::string EngineMetrics::histogram_json(const core::LatencyHistogram::Snapshot& snapshot) {
+        std::ostringstream out;
+        out << "{\"count\":" << snapshot.count
+            << ",\"mean\":" << snapshot.mean()
+            << ",\"p50\":" << snapshot.percentile(0.50)
+            << ",\"p90\":" << snapshot.percentile(0.90)
+            << ",\"p99\":" << snapshot.percentile(0.99)
+            << ",\"p999\":" << snapshot.percentile(0.999)
+            << ",\"max\":" << snapshot.max << "}";
+        return out.str();
+    }
+
+    std::string EngineMetrics::to_json_fields() const {
+        std::ostringstream out;
+        out << "\"stages_ns\":{";
+        for (int stage = 0; stage < STAGE_COUNT; ++stage) {
+            if (stage > 0) { out << ","; }
+            out << "\"" << stage_name(static_cast<Stage>(stage)) << "\":"
+                << histogram_json(stages_[stage].snapshot());
+        }
+        out << "},\"counters\":{";
+        for (int index = 0; index < COUNTER_COUNT; ++index) {
+            if (index > 0) { out << ","; }
+            out << "\"" << counter_name(static_cast<Counter>(index)) << "\":"
+                << counters_[index].load(std::memory_order_relaxed);
+        }
+        out << "}";
+        return out.str();
+    }
+}
@@ -1,22 +1,78 @@
 #include "app/application.hpp"
 #include <iostream>
 #include <string>
+#include <algorithm>
 
 int main(int argc, char* argv[]) {
-    if (argc != 4) {
-        std::cerr << "Kullanim: " << argv[0] << " <hedef_ip> <gonderme_portu> <dinleme_portu>" << std::endl;
-        std::cerr << "Ornek: " << argv[0] << " 127.0.0.1 9001 9002" << std::endl;
+    if (argc < 4) {
+        std::cerr << "Kullanim: " << argv[0] << " <hedef_ip> <gonderme_portu> <dinleme_portu>"
+                  << " [--ptime 10|20|40|60] [--no-dtx] [--playout-agc] [--io auto|socket|io_uring] [--rt fifo|rr] [--rt-priority n] [--net-cpus liste] [--dsp-cpus liste] [--mlock] [--stats-socket yol] [--stats-json dosya] [--stats-interval ms]" << std::endl;
+        std::cerr << "Ornek: " << argv[0] << " 127.0.0.1 9001 9002 --stats-socket /tmp/voice_engine.sock" << std::endl;
         return 1;
     }
     try {
         std::string target_ip = argv[1];
         int send_port = std::stoi(argv[2]);
         int listen_port = std::stoi(argv[3]);
-        app::Application app;
+
+        app::Application::Config config;
+        network::StatsEndpoint::Config stats;
+        for (int i = 4; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--ptime" && i + 1 < argc) {
+                config.ptime_ms = std::stoi(argv[++i]);
+                if (!codec::OpusCodec::is_valid_frame_duration(config.ptime_ms)) {
+                    std::cerr << "Paketleme süresi 10, 20, 40 veya 60 ms olmalı." << std::endl;
+                    return 1;
+                }
+            } else if (arg == "--no-dtx") {
+                config.dtx = false;
+            } else if (arg == "--playout-agc") {
+                config.playout_agc = true;
+            } else if (arg == "--io" && i + 1 < argc) {
+                if (!network::parse_io_backend(argv[++i], config.io_backend)) {
+                    std::cerr << "G/Ç yolu auto, socket veya io_uring olmalı." << std::endl;
+                    return 1;
+                }
+            } else if (arg == "--rt" && i + 1 < argc) {
+                core::SchedPolicy policy;
+                if (!core::parse_sched_policy(argv[++i], policy)) {
+                    std::cerr << "Zamanlama sınıfı default, fifo veya rr olmalı." << std::endl;
+                    return 1;
+                }
+                config.realtime.network.policy = policy;
+                config.realtime.processing.policy = policy;
+            } else if (arg == "--rt-priority" && i + 1 < argc) {
+                config.realtime.network.priority = std::stoi(argv[++i]);
+                config.realtime.processing.priority = config.realtime.network.priority;
+            } else if ((arg == "--net-cpus" || arg == "--dsp-cpus") && i + 1 < argc) {
+                auto& tuning = arg == "--net-cpus" ? config.realtime.network : config.realtime.processing;
+                if (!core::parse_cpu_list(argv[++i], tuning.cpus)) {
+                    std::cerr << "CPU listesi 0,2 veya 2-3 biçiminde olmalı." << std::endl;
+                    return 1;
+                }
+            } else if (arg == "--mlock") {
+                config.realtime.lock_memory = true;
+            } else if (arg == "--stats-socket" && i + 1 < argc) {
+                stats.socket_path = argv[++i];
+            } else if (arg == "--stats-json" && i + 1 < argc) {
+                stats.json_path = argv[++i];
+            } else if (arg == "--stats-interval" && i + 1 < argc) {
+                stats.dump_interval = std::chrono::milliseconds(std::max(100, std::stoi(argv[++i])));
+            } else {
+                std::cerr << "Bilinmeyen seçenek: " << arg << std::endl;
+                return 1;
+            }
+        }
+
+        app::Application app(config);
+        if (!stats.socket_path.empty() || !stats.json_path.empty()) {
+            app.enable_stats(stats);
+        }
         app.run(target_ip, send_port, listen_port);
     } catch (const std::exception& e) {
         std::cerr << "Program hatayla sonlandirildi: " << e.what() << std::endl;
         return 1;
     }
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,80 @@
+#include "conference/mixer_server.hpp"
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Kullanim: " << argv[0] << " <dinleme_portu> [cevap_portu] [thread_sayisi] [--io auto|socket|io_uring] [--rt fifo|rr] [--rt-priority n] [--net-cpus liste] [--dsp-cpus liste] [--mlock]" << std::endl;
+        std::cerr << "Ornek: " << argv[0] << " 9000 9002 0" << std::endl;
+        std::cerr << "  cevap_portu 0 ise karışım paketin geldiği kaynak porta gönderilir." << std::endl;
+        return 1;
+    }
+    try {
+        conference::MixerServer::Config config;
+        int positional = 0;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--io" && i + 1 < argc) {
+                if (!network::parse_io_backend(argv[++i], config.io_backend)) {
+                    std::cerr << "G/Ç yolu auto, socket veya io_uring olmalı." << std::endl;
+                    return 1;
+                }
+            } else if (arg == "--rt" && i + 1 < argc) {
+                core::SchedPolicy policy;
+                if (!core::parse_sched_policy(argv[++i], policy)) {
+                    std::cerr << "Zamanlama sınıfı default, fifo veya rr olmalı." << std::endl;
+                    return 1;
+                }
+                config.realtime.network.policy = policy;
+                config.realtime.processing.policy = policy;
+            } else if (arg == "--rt-priority" && i + 1 < argc) {
+                config.realtime.network.priority = std::stoi(argv[++i]);
+                config.realtime.processing.priority = config.realtime.network.priority;
+            } else if ((arg == "--net-cpus" || arg == "--dsp-cpus") && i + 1 < argc) {
+                auto& tuning = arg == "--net-cpus" ? config.realtime.network : config.realtime.processing;
+                if (!core::parse_cpu_list(argv[++i], tuning.cpus)) {
+                    std::cerr << "CPU listesi 0,2 veya 2-3 biçiminde olmalı." << std::endl;
+                    return 1;
+                }
+            } else if (arg == "--mlock") {
+                config.realtime.lock_memory = true;
+            } else if (positional == 0) {
+                config.port = std::stoi(arg);
+                ++positional;
+            } else if (positional == 1) {
+                config.reply_port = std::stoi(arg);
+                ++positional;
+            } else if (positional == 2) {
+                config.worker_threads = static_cast<size_t>(std::stoul(arg));
+                ++positional;
+            } else {
+                std::cerr << "Bilinmeyen seçenek: " << arg << std::endl;
+                return 1;
+            }
+        }
+
+        conference::MixerServer server(config);
+        if (!server.start()) { return 1; }
+
+        std::cout << ">>> Kapatmak icin Enter'a basin. <<<" << std::endl;
+        std::cin.get();
+        server.stop();
+
+        auto stats = server.get_stats();
+        std::cout << ">>> Mixer istatistikleri - tick: " << stats.ticks
+                  << ", decode: " << stats.frames_decoded
+                  << ", gizlenen: " << stats.frames_concealed
+                  << ", encode: " << stats.mixes_encoded
+                  << " (tick başına ort. " << (stats.ticks > 0 ? static_cast<double>(stats.mixes_encoded) / stats.ticks : 0.0)
+                  << ", konuşan ort. " << (stats.ticks > 0 ? static_cast<double>(stats.speakers_mixed) / stats.ticks : 0.0)
+                  << ", max " << stats.max_tick_encodes << ")"
+                  << ", gönderilen: " << stats.packets_sent
+                  << ", tick ort/max: " << stats.avg_tick_ns / 1000 << "/" << stats.max_tick_ns / 1000 << " us"
+                  << ", uyanma gecikmesi p99/max (" << core::sched_policy_name(stats.loop_policy) << "): "
+                  << stats.tick_lateness_p99_ns / 1000 << "/" << stats.tick_lateness_max_ns / 1000 << " us" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Program hatayla sonlandirildi: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
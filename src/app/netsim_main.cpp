@@ -0,0 +1,301 @@
+#include "network/impairment.hpp"
+#include "streaming/collector.hpp"
+#include "core/packet.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+    using Config = network::ImpairmentConfig;
+
+    constexpr auto FRAME_INTERVAL = std::chrono::milliseconds(10);
+    constexpr uint32_t FRAME_TIMESTAMP_STEP = 480;    // 10ms @ 48kHz
+    constexpr auto POLL_INTERVAL = std::chrono::milliseconds(1);
+    constexpr auto DRAIN_TIME = std::chrono::seconds(1);   // Son teslimattan sonra deadline'ların dolması için
+
+    struct Options {
+        bool proxy = false;
+        int listen_port = 0;
+        std::string target_ip;
+        int target_port = 0;
+        double duration_s = 60.0;
+        size_t payload_size = 80;                     // ~64 kbps Opus çerçevesi
+        Config impairment;
+    };
+
+    // Karşılaştırılan jitter buffer stratejileri; hepsi aynı ağ izini görür.
+    struct Strategy {
+        const char* name;
+        streaming::Collector::Config config;
+    };
+
+    std::vector<Strategy> make_strategies() {
+        std::vector<Strategy> strategies;
+        auto adaptive = [](float multiplier) {
+            streaming::Collector::Config config;
+            config.jitter_multiplier = multiplier;
+            return config;
+        };
+        auto fixed = [](int delay_ms) {
+            streaming::Collector::Config config;
+            config.min_delay = std::chrono::milliseconds(delay_ms);
+            config.max_delay = std::chrono::milliseconds(delay_ms);
+            return config;
+        };
+        strategies.push_back({"adaptif k=2", adaptive(2.0f)});
+        strategies.push_back({"adaptif k=3", adaptive(3.0f)});
+        strategies.push_back({"adaptif k=4", adaptive(4.0f)});
+        strategies.push_back({"sabit 20ms", fixed(20)});
+        strategies.push_back({"sabit 60ms", fixed(60)});
+        return strategies;
+    }
+
+    void print_usage(const char* program) {
+        std::cerr << "Kullanim: " << program << " [bozulma secenekleri] [--duration s] [--payload bayt]" << std::endl;
+        std::cerr << "          " << program << " --proxy <dinleme_portu> <hedef_ip> <hedef_port> [bozulma secenekleri]" << std::endl;
+        std::cerr << "Bozulma secenekleri:" << std::endl;
+        std::cerr << "  --seed N                 : Rastgelelik tohumu (varsayılan 1)" << std::endl;
+        std::cerr << "  --loss p                 : Bernoulli kayıp olasılığı" << std::endl;
+        std::cerr << "  --ge p_gb p_bg [k_g k_b] : Gilbert-Elliott geçiş ve durum kayıp olasılıkları" << std::endl;
+        std::cerr << "  --delay ms               : Sabit tek yön gecikme" << std::endl;
+        std::cerr << "  --jitter ms [dagilim]    : uniform | normal | pareto (varsayılan normal)" << std::endl;
+        std::cerr << "  --reorder p [ms]         : p olasılıkla ek gecikme (varsayılan 20ms)" << std::endl;
+        std::cerr << "  --duplicate p            : Tekrar olasılığı" << std::endl;
+        std::cerr << "  --bandwidth kbps [kuyruk]: Darboğaz hızı ve kuyruk boyu (bayt)" << std::endl;
+    }
+
+    double to_double(const char* text) { return std::stod(text); }
+    bool is_number(int i, int argc, char* argv[]) {
+        return i < argc && argv[i][0] != '-';
+    }
+
+    bool parse_options(int argc, char* argv[], Options& options) {
+        Config& config = options.impairment;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--proxy" && i + 3 < argc) {
+                options.proxy = true;
+                options.listen_port = std::stoi(argv[++i]);
+                options.target_ip = argv[++i];
+                options.target_port = std::stoi(argv[++i]);
+            } else if (arg == "--seed" && i + 1 < argc) {
+                config.seed = std::stoull(argv[++i]);
+            } else if (arg == "--duration" && i + 1 < argc) {
+                options.duration_s = to_double(argv[++i]);
+            } else if (arg == "--payload" && i + 1 < argc) {
+                options.payload_size = std::max<size_t>(4, std::stoul(argv[++i]));
+            } else if (arg == "--loss" && i + 1 < argc) {
+                config.loss_model = Config::LossModel::Bernoulli;
+                config.loss_rate = to_double(argv[++i]);
+            } else if (arg == "--ge" && i + 2 < argc) {
+                config.loss_model = Config::LossModel::GilbertElliott;
+                config.good_to_bad = to_double(argv[++i]);
+                config.bad_to_good = to_double(argv[++i]);
+                if (is_number(i + 1, argc, argv) && is_number(i + 2, argc, argv)) {
+                    config.loss_in_good = to_double(argv[++i]);
+                    config.loss_in_bad = to_double(argv[++i]);
+                }
+            } else if (arg == "--delay" && i + 1 < argc) {
+                config.base_delay = std::chrono::microseconds(static_cast<int64_t>(to_double(argv[++i]) * 1000.0));
+            } else if (arg == "--jitter" && i + 1 < argc) {
+                config.jitter = std::chrono::microseconds(static_cast<int64_t>(to_double(argv[++i]) * 1000.0));
+                config.jitter_distribution = Config::DelayDistribution::Normal;
+                if (is_number(i + 1, argc, argv)) {
+                    const std::string distribution = argv[++i];
+                    if (distribution == "uniform") {
+                        config.jitter_distribution = Config::DelayDistribution::Uniform;
+                    } else if (distribution == "pareto") {
+                        config.jitter_distribution = Config::DelayDistribution::Pareto;
+                    } else if (distribution != "normal") {
+                        return false;
+                    }
+                }
+            } else if (arg == "--reorder" && i + 1 < argc) {
+                config.reorder_rate = to_double(argv[++i]);
+                if (is_number(i + 1, argc, argv)) {
+                    config.reorder_delay = std::chrono::microseconds(static_cast<int64_t>(to_double(argv[++i]) * 1000.0));
+                }
+            } else if (arg == "--duplicate" && i + 1 < argc) {
+                config.duplicate_rate = to_double(argv[++i]);
+            } else if (arg == "--bandwidth" && i + 1 < argc) {
+                config.bandwidth_bps = static_cast<uint64_t>(to_double(argv[++i]) * 1000.0);
+                if (is_number(i + 1, argc, argv)) {
+                    config.queue_limit_bytes = std::stoul(argv[++i]);
+                }
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    struct Delivery {
+        Clock::time_point arrival;
+        uint32_t frame;
+    };
+
+    // Gönderici tarafı: her 10ms'de bir çerçeve, modelden geçen teslim anlarıyla birlikte.
+    // İz bir kez üretilir ve tüm stratejilere aynen oynatılır.
+    std::vector<Delivery> build_trace(const Options& options, Clock::time_point origin, uint32_t frames,
+                                      network::ImpairmentModel& model) {
+        std::vector<Delivery> trace;
+        std::vector<Clock::time_point> deliveries;
+        const size_t datagram_size = core::RTP_HEADER_SIZE + options.payload_size;
+        for (uint32_t frame = 0; frame < frames; ++frame) {
+            model.process(origin + frame * FRAME_INTERVAL, datagram_size, deliveries);
+            for (auto arrival : deliveries) {
+                trace.push_back({arrival, frame});
+            }
+        }
+        std::stable_sort(trace.begin(), trace.end(), [](const Delivery& a, const Delivery& b) {
+            return a.arrival < b.arrival;
+        });
+        return trace;
+    }
+
+    struct StrategyResult {
+        streaming::Collector::Stats stats;
+        std::vector<uint32_t> latency_us;   // Gönderimden jitter buffer çıkışına
+        uint64_t out_of_order = 0;          // Alıcıya sırasız varan datagramlar
+        uint64_t unplayed = 0;              // Ne çalınan ne gizlenen çerçeveler (reset atlaması vb.), kayıp sayılır
+    };
+
+    StrategyResult run_strategy(const Strategy& strategy, const Options& options, const std::vector<Delivery>& trace,
+                                Clock::time_point origin, uint32_t frames) {
+        StrategyResult result;
+        streaming::Collector collector(strategy.config);
+        Clock::time_point now = origin;
+
+        auto on_release = [&](const std::vector<uint8_t>& payload) {
+            if (payload.size() < sizeof(uint32_t)) { return; }
+            uint32_t frame = 0;
+            std::memcpy(&frame, payload.data(), sizeof(frame));
+            auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - (origin + frame * FRAME_INTERVAL));
+            result.latency_us.push_back(static_cast<uint32_t>(std::max<int64_t>(0, latency.count())));
+        };
+
+        std::vector<uint8_t> payload(options.payload_size, 0);
+        core::PacketView view;
+        view.ssrc = 0x4E455453;   // "NETS"
+        view.payload = payload.data();
+        view.payload_size = payload.size();
+
+        // İz tamamen oynatılana kadar koşulur: darboğaz kuyruğu teslimleri gönderim süresinin çok
+        // ötesine itebilir, bunlar sessizce yok sayılmamalı
+        Clock::time_point last_arrival = origin + frames * FRAME_INTERVAL;
+        if (!trace.empty()) {
+            last_arrival = std::max(last_arrival, trace.back().arrival);
+        }
+        const Clock::time_point end = last_arrival + DRAIN_TIME;
+        size_t next = 0;
+        uint32_t highest_frame = 0;
+        for (Clock::time_point tick = origin; tick <= end; tick += POLL_INTERVAL) {
+            while (next < trace.size() && trace[next].arrival <= tick) {
+                const Delivery& delivery = trace[next++];
+                if (delivery.frame < highest_frame) { result.out_of_order++; }
+                highest_frame = std::max(highest_frame, delivery.frame);
+
+                std::memcpy(payload.data(), &delivery.frame, sizeof(delivery.frame));
+                view.sequence_number = static_cast<uint16_t>(delivery.frame);
+                view.timestamp = delivery.frame * FRAME_TIMESTAMP_STEP;
+                view.marker = delivery.frame == 0;
+                now = delivery.arrival;
+                collector.collect(view, on_release, now);
+            }
+            now = tick;
+            collector.poll(on_release, now);
+        }
+        result.stats = collector.get_stats();
+        const auto& stats = result.stats;
+        const uint64_t accounted = stats.released + stats.concealed + stats.skipped + stats.silence_gaps;
+        result.unplayed = accounted < frames ? frames - accounted : 0;
+        return result;
+    }
+
+    uint32_t percentile(const std::vector<uint32_t>& sorted, double p) {
+        if (sorted.empty()) { return 0; }
+        const size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+
+    int run_simulation(const Options& options) {
+        const uint32_t frames = static_cast<uint32_t>(options.duration_s * 100.0);
+        const Clock::time_point origin = Clock::now();
+
+        network::ImpairmentModel model(options.impairment);
+        const std::vector<Delivery> trace = build_trace(options, origin, frames, model);
+        const auto network_stats = model.get_stats();
+
+        std::cout << "Ağ izi (seed " << options.impairment.seed << "): gönderilen " << network_stats.sent
+                  << ", kayıp " << network_stats.lost
+                  << ", kuyruk düşürme " << network_stats.queue_drops
+                  << ", tekrar " << network_stats.duplicated
+                  << ", yeniden sıralanan " << network_stats.reordered
+                  << ", teslim " << network_stats.delivered << std::endl << std::endl;
+
+        std::cout << std::left << std::setw(14) << "strateji" << std::right
+                  << std::setw(9) << "p50 ms" << std::setw(9) << "p95 ms" << std::setw(9) << "p99 ms"
+                  << std::setw(9) << "max ms" << std::setw(10) << "gizleme%"
+                  << std::setw(8) << "gec" << std::setw(8) << "atlanan" << std::setw(11) << "calinmayan" << std::setw(8) << "tekrar"
+                  << std::setw(8) << "reset" << std::setw(8) << "sirasiz" << std::setw(10) << "hedef ms" << std::endl;
+
+        for (const auto& strategy : make_strategies()) {
+            StrategyResult result = run_strategy(strategy, options, trace, origin, frames);
+            std::sort(result.latency_us.begin(), result.latency_us.end());
+            const auto& stats = result.stats;
+            const uint64_t missing = stats.concealed + stats.skipped + result.unplayed;
+            const double concealment = frames ? 100.0 * static_cast<double>(missing) / frames : 0.0;
+            auto ms = [](uint32_t us) { return static_cast<double>(us) / 1000.0; };
+
+            std::cout << std::left << std::setw(14) << strategy.name << std::right << std::fixed << std::setprecision(1)
+                      << std::setw(9) << ms(percentile(result.latency_us, 0.50))
+                      << std::setw(9) << ms(percentile(result.latency_us, 0.95))
+                      << std::setw(9) << ms(percentile(result.latency_us, 0.99))
+                      << std::setw(9) << ms(result.latency_us.empty() ? 0 : result.latency_us.back())
+                      << std::setprecision(2) << std::setw(10) << concealment
+                      << std::setw(8) << stats.late << std::setw(8) << stats.skipped << std::setw(11) << result.unplayed
+                      << std::setw(8) << stats.duplicates << std::setw(8) << stats.resets
+                      << std::setw(8) << result.out_of_order
+                      << std::setprecision(1) << std::setw(10) << stats.target_delay_ms << std::endl;
+        }
+        return 0;
+    }
+
+    int run_proxy(const Options& options) {
+        network::ImpairmentProxy proxy(options.impairment);
+        if (!proxy.start(options.listen_port, options.target_ip, options.target_port)) {
+            return 1;
+        }
+        std::cout << ">>> Kapatmak icin Enter'a basin. <<<" << std::endl;
+        std::cin.get();
+        proxy.stop();
+
+        auto stats = proxy.get_stats();
+        std::cout << ">>> Proxy istatistikleri - gelen: " << stats.sent
+                  << ", kayıp: " << stats.lost
+                  << ", kuyruk düşürme: " << stats.queue_drops
+                  << ", tekrar: " << stats.duplicated
+                  << ", yeniden sıralanan: " << stats.reordered
+                  << ", iletilen: " << stats.delivered << std::endl;
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        if (!parse_options(argc, argv, options)) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        return options.proxy ? run_proxy(options) : run_simulation(options);
+    } catch (const std::exception& e) {
+        std::cerr << "Program hatayla sonlandirildi: " << e.what() << std::endl;
+        return 1;
+    }
+}
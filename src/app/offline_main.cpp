@@ -0,0 +1,212 @@
+#include "app/offline_pipeline.hpp"
+#include "core/pcm_file.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+
+namespace {
+    struct Options {
+        std::string input_path;
+        std::string output_path;
+        std::string far_path;
+        size_t pipelines = 1;
+        bool sweep = false;
+        app::OfflinePipeline::Config pipeline;
+    };
+
+    void print_usage(const char* program) {
+        std::cerr << "Kullanim: " << program << " <girdi.wav|girdi.raw> [cikti.wav|cikti.raw] [-j N] [--sweep] [--far uzak.wav] [--ptime ms]" << std::endl;
+        std::cerr << "  Ham (.raw) dosyalar 48kHz mono little-endian int16 kabul edilir." << std::endl;
+        std::cerr << "  -j N     : N bağımsız hattı paralel çalıştır (çekirdek ölçeklemesi)" << std::endl;
+        std::cerr << "  --sweep  : 1, 2, 4, ... N hat için ölçekleme tablosu yazdır" << std::endl;
+        std::cerr << "  --far    : Yankı giderici için oynatma (uzak uç) referansı" << std::endl;
+        std::cerr << "  --ptime  : Opus paket süresi (10, 20, 40, 60 ms)" << std::endl;
+    }
+
+    bool parse_options(int argc, char* argv[], Options& options) {
+        std::vector<std::string> positional;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "-j" && i + 1 < argc) {
+                options.pipelines = std::max<size_t>(1, static_cast<size_t>(std::stoul(argv[++i])));
+            } else if (arg == "--sweep") {
+                options.sweep = true;
+            } else if (arg == "--far" && i + 1 < argc) {
+                options.far_path = argv[++i];
+            } else if (arg == "--ptime" && i + 1 < argc) {
+                options.pipeline.ptime_ms = std::stoi(argv[++i]);
+                if (!codec::OpusCodec::is_valid_frame_duration(options.pipeline.ptime_ms)) { return false; }
+            } else if (!arg.empty() && arg[0] == '-') {
+                return false;
+            } else {
+                positional.push_back(arg);
+            }
+        }
+        if (positional.empty() || positional.size() > 2) { return false; }
+        options.input_path = positional[0];
+        if (positional.size() > 1) { options.output_path = positional[1]; }
+        return true;
+    }
+
+    bool load_mono(const std::string& path, std::vector<int16_t>& samples) {
+        core::PcmAudio audio;
+        if (!core::read_pcm_file(path, audio)) { return false; }
+        if (audio.sample_rate != app::OfflinePipeline::SAMPLE_RATE) {
+            std::cerr << "HATA: " << path << " örnekleme hızı " << audio.sample_rate
+                      << " Hz; yalnızca " << app::OfflinePipeline::SAMPLE_RATE << " Hz desteklenir." << std::endl;
+            return false;
+        }
+        core::downmix_to_mono(audio);
+        samples = std::move(audio.samples);
+        return true;
+    }
+
+    uint32_t percentile(const std::vector<uint32_t>& sorted, double p) {
+        if (sorted.empty()) { return 0; }
+        const size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+
+    struct RunSummary {
+        std::vector<app::OfflinePipeline::Result> results;
+        double wall_seconds = 0.0;
+    };
+
+    // Hatlar önceden oluşturulur; yalnızca run() süresi ölçülür
+    RunSummary run_parallel(size_t count, const app::OfflinePipeline::Config& config, const std::vector<int16_t>& input,
+                            const std::vector<int16_t>& far_end, bool keep_first_output) {
+        std::vector<std::unique_ptr<app::OfflinePipeline>> pipelines;
+        for (size_t i = 0; i < count; ++i) {
+            pipelines.push_back(std::make_unique<app::OfflinePipeline>(config));
+        }
+
+        RunSummary summary;
+        summary.results.resize(count);
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            threads.emplace_back([&, i] {
+                summary.results[i] = pipelines[i]->run(input, far_end, keep_first_output && i == 0);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        summary.wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return summary;
+    }
+
+    void print_stage_table(const RunSummary& summary) {
+        using Pipeline = app::OfflinePipeline;
+        std::cout << std::left << std::setw(18) << "asama" << std::right
+                  << std::setw(10) << "cerceve" << std::setw(10) << "p50 ns" << std::setw(10) << "p90 ns"
+                  << std::setw(10) << "p99 ns" << std::setw(10) << "max ns" << std::endl;
+
+        auto print_row = [](const std::string& name, std::vector<uint32_t> samples) {
+            std::sort(samples.begin(), samples.end());
+            std::cout << std::left << std::setw(18) << name << std::right
+                      << std::setw(10) << samples.size()
+                      << std::setw(10) << percentile(samples, 0.50)
+                      << std::setw(10) << percentile(samples, 0.90)
+                      << std::setw(10) << percentile(samples, 0.99)
+                      << std::setw(10) << (samples.empty() ? 0 : samples.back()) << std::endl;
+        };
+
+        // DSP geçişleri sıra numarasına göre (birleştirilmiş örnek grubu tek satır)
+        for (size_t pass = 0; pass < Pipeline::CAPTURE_PASSES; ++pass) {
+            std::vector<uint32_t> merged;
+            for (const auto& result : summary.results) {
+                merged.insert(merged.end(), result.capture_passes[pass].ns.begin(), result.capture_passes[pass].ns.end());
+            }
+            const std::string name = summary.results.empty() ? "?" : Pipeline::capture_pass_name(summary.results.front(), pass);
+            print_row(name, std::move(merged));
+        }
+        for (int stage = 0; stage < Pipeline::STAGE_COUNT; ++stage) {
+            std::vector<uint32_t> merged;
+            for (const auto& result : summary.results) {
+                merged.insert(merged.end(), result.stage_ns[stage].begin(), result.stage_ns[stage].end());
+            }
+            print_row(Pipeline::stage_name(static_cast<Pipeline::Stage>(stage)), std::move(merged));
+        }
+        std::vector<uint32_t> frames;
+        for (const auto& result : summary.results) {
+            frames.insert(frames.end(), result.frame_ns.begin(), result.frame_ns.end());
+        }
+        print_row("toplam", std::move(frames));
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    try {
+        std::vector<int16_t> input;
+        std::vector<int16_t> far_end;
+        if (!load_mono(options.input_path, input)) { return 1; }
+        if (!options.far_path.empty() && !load_mono(options.far_path, far_end)) { return 1; }
+
+        const size_t frames = input.size() / app::OfflinePipeline::FRAME_SAMPLES;
+        if (frames == 0) {
+            std::cerr << "HATA: Girdi bir çerçeveden (10ms) kısa." << std::endl;
+            return 1;
+        }
+        const double audio_seconds = static_cast<double>(frames) / 100.0;
+
+        RunSummary summary = run_parallel(options.pipelines, options.pipeline, input, far_end, !options.output_path.empty());
+        const auto& first = summary.results.front();
+        const double total_frames = static_cast<double>(frames * options.pipelines);
+
+        std::cout << "\n>>> Çevrimdışı hat: " << frames << " çerçeve (" << audio_seconds << " s), "
+                  << options.pipelines << " paralel hat, ptime " << options.pipeline.ptime_ms << " ms" << std::endl;
+        std::cout << ">>> Gönderilen çerçeve/paket, decode edilen paket (hat 0): " << first.frames_sent << "/"
+                  << first.packets_sent << ", " << first.frames_decoded << std::endl;
+        std::cout << ">>> AGC (hat 0): kazanç " << first.agc.gain << ", sınırlayıcı " << first.agc.limiter_gain
+                  << ", sınırlanan blok " << first.agc.limited_blocks << ", ileri bakış gecikmesi "
+                  << first.capture_latency_samples << " örnek" << std::endl;
+        print_stage_table(summary);
+        std::cout << ">>> Çerçeve/s: " << std::fixed << std::setprecision(0) << total_frames / summary.wall_seconds
+                  << std::setprecision(4) << ", gerçek zaman faktörü (işlem/ses süresi, hat başına): "
+                  << summary.wall_seconds / audio_seconds
+                  << std::setprecision(1) << ", toplam " << (audio_seconds * static_cast<double>(options.pipelines)) / summary.wall_seconds
+                  << "x gerçek zaman" << std::endl;
+
+        if (options.sweep) {
+            std::cout << "\n" << std::setw(6) << "hat" << std::setw(14) << "cerceve/s" << std::setw(10) << "hizlanma"
+                      << std::setw(10) << "verim" << std::endl;
+            double baseline = 0.0;
+            for (size_t n = 1; n <= options.pipelines; n *= 2) {
+                RunSummary run = run_parallel(n, options.pipeline, input, far_end, false);
+                const double rate = static_cast<double>(frames * n) / run.wall_seconds;
+                if (n == 1) { baseline = rate; }
+                const double speedup = rate / baseline;
+                std::cout << std::setw(6) << n << std::setw(14) << std::setprecision(0) << rate
+                          << std::setw(10) << std::setprecision(2) << speedup
+                          << std::setw(9) << std::setprecision(0) << 100.0 * speedup / static_cast<double>(n) << "%" << std::endl;
+                if (n * 2 > options.pipelines && n != options.pipelines) {
+                    n = options.pipelines / 2; // Son adım tam olarak N
+                }
+            }
+        }
+
+        if (!options.output_path.empty()) {
+            core::PcmAudio output;
+            output.samples = first.output;
+            output.sample_rate = app::OfflinePipeline::SAMPLE_RATE;
+            output.channels = 1;
+            if (!core::write_pcm_file(options.output_path, output)) { return 1; }
+            std::cout << ">>> Çıktı yazıldı: " << options.output_path << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Program hatayla sonlandirildi: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,170 @@
+#include "app/offline_pipeline.hpp"
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+
+namespace app {
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    // CapturePipeline aşama sırasıyla: EC, NS, VAD, AGC
+    const char* const CAPTURE_STAGE_NAMES[] = {"echo_canceller", "noise_suppressor", "vad", "agc/limiter"};
+    static_assert(sizeof(CAPTURE_STAGE_NAMES) / sizeof(CAPTURE_STAGE_NAMES[0]) == processing::CapturePipeline::STAGE_COUNT,
+                  "Her yakalama aşamasının bir adı olmalı");
+
+    uint32_t elapsed_ns(Clock::time_point start, Clock::time_point end) {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+}
+
+const char* OfflinePipeline::capture_stage_name(size_t stage) {
+    return stage < processing::CapturePipeline::STAGE_COUNT ? CAPTURE_STAGE_NAMES[stage] : "?";
+}
+
+const char* OfflinePipeline::stage_name(Stage stage) {
+    switch (stage) {
+        case ENCODE: return "encode";
+        case PACKETIZE: return "slice+serialize";
+        case COLLECT: return "parse+collect";
+        case DECODE: return "decode";
+        case STAGE_COUNT: break;
+    }
+    return "?";
+}
+
+std::string OfflinePipeline::capture_pass_name(const Result& result, size_t pass) {
+    if (pass >= CAPTURE_PASSES) { return "?"; }
+    const size_t end = pass + 1 < CAPTURE_PASSES ? result.capture_passes[pass + 1].first_stage
+                                                 : processing::CapturePipeline::STAGE_COUNT;
+    std::string name;
+    for (size_t stage = result.capture_passes[pass].first_stage; stage < end; ++stage) {
+        if (!name.empty()) { name += '+'; }
+        name += capture_stage_name(stage);
+    }
+    return name;
+}
+
+OfflinePipeline::OfflinePipeline() : OfflinePipeline(Config{}) {}
+
+OfflinePipeline::OfflinePipeline(const Config& config)
+    : encoder_(std::make_unique<codec::OpusCodec>(SAMPLE_RATE, 1, config.ptime_ms)),
+      decoder_(std::make_unique<codec::OpusCodec>(SAMPLE_RATE, 1)),
+      slicer_(std::make_unique<streaming::Slicer>()),
+      collector_(std::make_unique<streaming::Collector>()),
+      config_(config),
+      frame_(FRAME_SAMPLES),
+      accumulator_(FRAME_SAMPLES, static_cast<size_t>(std::max(1, config.ptime_ms / 10))),
+      encode_buffer_(codec::OpusCodec::MAX_PACKET_SIZE),
+      datagram_buffer_(core::RTP_HEADER_SIZE + codec::OpusCodec::MAX_PACKET_SIZE),
+      decode_buffer_(decoder_->max_decoded_samples()) {
+    outgoing_packets_.reserve(8);
+}
+
+OfflinePipeline::Result OfflinePipeline::run(const std::vector<int16_t>& input, const std::vector<int16_t>& far_end,
+                                             bool keep_output) {
+    Result result;
+    result.frames = input.size() / FRAME_SAMPLES;
+    for (auto& pass : result.capture_passes) {
+        pass.ns.reserve(result.frames);
+    }
+    for (auto& samples : result.stage_ns) {
+        samples.reserve(result.frames);
+    }
+    result.frame_ns.reserve(result.frames);
+    if (keep_output) {
+        result.output.assign(result.frames * FRAME_SAMPLES, 0);
+    }
+
+    uint32_t timestamp = 0;
+    bool was_voice_active = false;
+    size_t output_offset = 0;
+    uint32_t decode_ns = 0;
+
+    // Alım tarafı: Collector sıradaki paketi hemen bırakır, decode bu çerçevenin yerine yazılır
+    auto on_collected = [&](const std::vector<uint8_t>& payload) {
+        const auto start = Clock::now();
+        const size_t decoded = decoder_->decode(payload.data(), payload.size(), decode_buffer_.data(), decode_buffer_.size());
+        decode_ns += elapsed_ns(start, Clock::now());
+        if (decoded == 0) { return; }
+        ++result.frames_decoded;
+        if (keep_output) {
+            const size_t n = std::min(decoded, result.output.size() - std::min(output_offset, result.output.size()));
+            std::copy(decode_buffer_.data(), decode_buffer_.data() + n, result.output.begin() + output_offset);
+        }
+    };
+
+    accumulator_.clear();
+    for (size_t f = 0; f < result.frames; ++f) {
+        const int16_t* pcm = input.data() + f * FRAME_SAMPLES;
+        const uint32_t frame_timestamp = timestamp;
+        timestamp += static_cast<uint32_t>(FRAME_SAMPLES);
+
+        if (far_end.size() >= (f + 1) * FRAME_SAMPLES) {
+            capture_pipeline_.stage<processing::EchoCancellerStage>().on_playback(far_end.data() + f * FRAME_SAMPLES, FRAME_SAMPLES);
+        }
+
+        const auto frame_start = Clock::now();
+        frame_.assign(pcm, FRAME_SAMPLES);
+
+        Clock::time_point t1 = Clock::now();
+        size_t pass = 0;
+        const bool voice = capture_pipeline_.process(frame_, [&](size_t first_stage) {
+            const auto pass_end = Clock::now();
+            CapturePass& timing = result.capture_passes[pass++];
+            timing.first_stage = first_stage;
+            timing.ns.push_back(elapsed_ns(t1, pass_end));
+            t1 = pass_end;
+        });
+        Clock::time_point t0;
+
+        const bool packet_ready = accumulator_.push(frame_.data(), frame_.size(), frame_timestamp, voice);
+        if (packet_ready && accumulator_.has_voice()) {
+            const bool talkspurt_start = !was_voice_active;
+            was_voice_active = true;
+            // Decode edilen paket, ilk çerçevesinin yerine yazılır
+            output_offset = (f + 1 - accumulator_.frames()) * FRAME_SAMPLES;
+
+            const size_t encoded = encoder_->encode(accumulator_.data(), accumulator_.size(), encode_buffer_.data(), encode_buffer_.size());
+            t0 = Clock::now();
+            result.stage_ns[ENCODE].push_back(elapsed_ns(t1, t0));
+
+            if (encoded > 0) {
+                ++result.packets_sent;
+                result.frames_sent += accumulator_.frames();
+                slicer_->slice(encode_buffer_.data(), encoded, 1000, accumulator_.timestamp(), talkspurt_start, outgoing_packets_);
+                uint32_t packetize_ns = elapsed_ns(t0, Clock::now());
+                uint32_t collect_ns = 0;
+                // Ağ yerine datagram tamponu: serialize edilen her paket hemen alım zincirine verilir
+                for (const auto& packet : outgoing_packets_) {
+                    const auto s0 = Clock::now();
+                    const size_t size = packet.serialize(datagram_buffer_.data(), datagram_buffer_.size());
+                    const auto s1 = Clock::now();
+                    packetize_ns += elapsed_ns(s0, s1);
+
+                    decode_ns = 0;
+                    core::PacketView received;
+                    if (size > 0 && core::PacketView::parse(datagram_buffer_.data(), size, received)) {
+                        collector_->collect(received, on_collected);
+                    }
+                    collect_ns += elapsed_ns(s1, Clock::now()) - decode_ns;
+                    if (decode_ns > 0) {
+                        result.stage_ns[DECODE].push_back(decode_ns);
+                    }
+                }
+                result.stage_ns[PACKETIZE].push_back(packetize_ns);
+                result.stage_ns[COLLECT].push_back(collect_ns);
+            }
+            accumulator_.clear();
+        } else if (packet_ready) {
+            was_voice_active = false;
+            accumulator_.clear();
+        }
+
+        result.frame_ns.push_back(elapsed_ns(frame_start, Clock::now()));
+    }
+    const auto& gain = capture_pipeline_.stage<processing::GainStage>().controller();
+    result.agc = gain.get_stats();
+    result.capture_latency_samples = gain.latency_samples();
+    return result;
+}
+}
@@ -1,5 +1,7 @@
 #include "capture/audio_capturer.hpp"
 #include <iostream>
+#include <algorithm>
+#include <stdexcept>
 
 namespace capture {
 class PortAudioInitializer {
@@ -15,46 +17,199 @@ private:
 };
 static PortAudioInitializer pa_initializer;
 
-AudioCapturer::AudioCapturer() { if (pa_initializer.get_error() != paNoError) { throw std::runtime_error("PortAudio başlatılamadı."); } }
+AudioCapturer::AudioCapturer() : AudioCapturer(PipelineConfig{}) {}
+
+AudioCapturer::AudioCapturer(const PipelineConfig& config) : config_(config) {
+    if (pa_initializer.get_error() != paNoError) { throw std::runtime_error("PortAudio başlatılamadı."); }
+    if (config_.mode == CaptureMode::Pipelined) {
+        // Kuyruk ve worker tamponu bir kez ayrılır; callback içinde allocation yapılmaz
+        // DropOldest: yedek kapasite sayesinde callback en yeni çerçeveyi yazabilir, fazlayı worker atar
+        const size_t depth = std::max<size_t>(config_.queue_depth, 1);
+        const size_t capacity = config_.overflow_policy == OverflowPolicy::DropOldest ? 2 * depth : depth;
+        queue_ = std::make_unique<core::SpscRingBuffer<CapturedFrame>>(capacity);
+        worker_frame_.reserve(FRAMES_PER_BUFFER * NUM_CHANNELS);
+    }
+}
 AudioCapturer::~AudioCapturer() { stop(); }
 
 bool AudioCapturer::start(AudioCallback callback) {
     if (is_capturing_) { return true; }
     user_callback_ = std::move(callback);
+    if (config_.mode == CaptureMode::Pipelined) {
+        worker_running_ = true;
+        worker_thread_ = std::thread(&AudioCapturer::worker_loop, this);
+    }
     PaStreamParameters input_parameters;
     input_parameters.device = Pa_GetDefaultInputDevice();
-    if (input_parameters.device == paNoDevice) { std::cerr << "HATA: Varsayılan giriş aygıtı bulunamadı." << std::endl; return false; }
+    if (input_parameters.device == paNoDevice) { std::cerr << "HATA: Varsayılan giriş aygıtı bulunamadı." << std::endl; stop(); return false; }
     input_parameters.channelCount = NUM_CHANNELS;
     input_parameters.sampleFormat = FORMAT;
     input_parameters.suggestedLatency = Pa_GetDeviceInfo(input_parameters.device)->defaultLowInputLatency;
     input_parameters.hostApiSpecificStreamInfo = nullptr;
     PaError err = Pa_OpenStream(&stream_, &input_parameters, nullptr, SAMPLE_RATE, FRAMES_PER_BUFFER, paClipOff, &AudioCapturer::pa_callback, this);
-    if (err != paNoError) { std::cerr << "PortAudio HATA: Pa_OpenStream() - " << Pa_GetErrorText(err) << std::endl; return false; }
+    if (err != paNoError) { std::cerr << "PortAudio HATA: Pa_OpenStream() - " << Pa_GetErrorText(err) << std::endl; stop(); return false; }
     err = Pa_StartStream(stream_);
-    if (err != paNoError) { std::cerr << "PortAudio HATA: Pa_StartStream() - " << Pa_GetErrorText(err) << std::endl; Pa_CloseStream(stream_); stream_ = nullptr; return false; }
+    if (err != paNoError) { std::cerr << "PortAudio HATA: Pa_StartStream() - " << Pa_GetErrorText(err) << std::endl; Pa_CloseStream(stream_); stream_ = nullptr; stop(); return false; }
     is_capturing_ = true;
     std::cout << "Ses yakalama başlatıldı." << std::endl;
     return true;
 }
 
 void AudioCapturer::stop() {
-    if (!is_capturing_ || !stream_) { return; }
-    Pa_StopStream(stream_);
-    Pa_CloseStream(stream_);
-    stream_ = nullptr;
-    is_capturing_ = false;
-    std::cout << "Ses yakalama durduruldu." << std::endl;
+    // Önce stream durdurulur (üretici), sonra worker (tüketici)
+    bool was_capturing = is_capturing_ && stream_;
+    if (was_capturing) {
+        Pa_StopStream(stream_);
+        Pa_CloseStream(stream_);
+        stream_ = nullptr;
+        is_capturing_ = false;
+    }
+    if (worker_thread_.joinable()) {
+        worker_running_ = false;
+        worker_cv_.notify_one();
+        worker_thread_.join();
+    }
+    if (was_capturing) {
+        std::cout << "Ses yakalama durduruldu." << std::endl;
+    }
 }
 
 bool AudioCapturer::is_capturing() const { return is_capturing_; }
 
-int AudioCapturer::pa_callback(const void* i, void*, unsigned long f, const PaStreamCallbackTimeInfo*, PaStreamCallbackFlags, void* u) {
-    return static_cast<AudioCapturer*>(u)->process(static_cast<const int16_t*>(i), f);
+AudioCapturer::PipelineStats AudioCapturer::get_stats() const {
+    PipelineStats stats;
+    stats.frames_captured = frames_captured_.load(std::memory_order_relaxed);
+    stats.frames_processed = frames_processed_.load(std::memory_order_relaxed);
+    stats.frames_dropped = frames_dropped_.load(std::memory_order_relaxed);
+    stats.input_overflows = input_overflows_.load(std::memory_order_relaxed);
+    stats.max_latency_ns = max_latency_ns_.load(std::memory_order_relaxed);
+    if (stats.frames_processed > 0) {
+        stats.avg_latency_ns = latency_sum_ns_.load(std::memory_order_relaxed) / stats.frames_processed;
+    }
+    stats.queue_size = queue_ ? queue_->size() : 0;
+    stats.worker_policy = worker_policy_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+int AudioCapturer::pa_callback(const void* i, void*, unsigned long f, const PaStreamCallbackTimeInfo*, PaStreamCallbackFlags flags, void* u) {
+    return static_cast<AudioCapturer*>(u)->process(static_cast<const int16_t*>(i), f, flags);
 }
-int AudioCapturer::process(const int16_t* inputBuffer, unsigned long framesPerBuffer) {
-    if (inputBuffer && user_callback_) {
-        user_callback_(std::vector<int16_t>(inputBuffer, inputBuffer + (framesPerBuffer * NUM_CHANNELS)));
+int AudioCapturer::process(const int16_t* inputBuffer, unsigned long framesPerBuffer, PaStreamCallbackFlags statusFlags) {
+    if (statusFlags & paInputOverflow) {
+        input_overflows_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!inputBuffer || !user_callback_) { return paContinue; }
+
+    const size_t sample_count = framesPerBuffer * NUM_CHANNELS;
+    frames_captured_.fetch_add(1, std::memory_order_relaxed);
+    if (config_.mode == CaptureMode::Pipelined) {
+        enqueue(inputBuffer, sample_count);
+    } else {
+        auto captured_at = std::chrono::steady_clock::now();
+        current_frame_timestamp_ = captured_at;
+        user_callback_(std::vector<int16_t>(inputBuffer, inputBuffer + sample_count));
+        record_latency(captured_at);
     }
     return paContinue;
 }
+
+void AudioCapturer::enqueue(const int16_t* samples, size_t sample_count) {
+    // Realtime thread: sadece sabit boyutlu slot'a kopyala ve worker'ı uyandır
+    if (config_.overflow_policy == OverflowPolicy::DropOldest) {
+        // Taşma yuvası doluyken kuyruğa yazılmaz: yuvadaki çerçeve kuyruktakilerden yenidir
+        if (overflow_pending_.load(std::memory_order_acquire) || queue_->size() >= queue_->capacity()) {
+            store_overflow(samples, sample_count);
+            worker_cv_.notify_one();
+            return;
+        }
+    } else if (queue_->size() >= config_.queue_depth) {
+        frames_dropped_.fetch_add(1, std::memory_order_relaxed);
+        worker_cv_.notify_one();
+        return;
+    }
+
+    CapturedFrame frame;
+    frame.sample_count = std::min(sample_count, frame.samples.size());
+    std::copy(samples, samples + frame.sample_count, frame.samples.begin());
+    frame.timestamp = std::chrono::steady_clock::now();
+    queue_->try_push(frame);
+    worker_cv_.notify_one();
+}
+
+void AudioCapturer::store_overflow(const int16_t* samples, size_t sample_count) {
+    if (overflow_lock_.test_and_set(std::memory_order_acquire)) {
+        // Worker yuvayı o an kopyalıyor: beklenmez, bu çerçeve atılır
+        frames_dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (overflow_pending_.load(std::memory_order_relaxed)) {
+        frames_dropped_.fetch_add(1, std::memory_order_relaxed);   // Yuvadaki daha eski çerçeve
+    }
+    overflow_frame_.sample_count = std::min(sample_count, overflow_frame_.samples.size());
+    std::copy(samples, samples + overflow_frame_.sample_count, overflow_frame_.samples.begin());
+    overflow_frame_.timestamp = std::chrono::steady_clock::now();
+    overflow_pending_.store(true, std::memory_order_release);
+    overflow_lock_.clear(std::memory_order_release);
+}
+
+bool AudioCapturer::take_overflow(CapturedFrame& frame) {
+    if (!overflow_pending_.load(std::memory_order_acquire)) { return false; }
+    // Callback kilidi yalnızca bir çerçeve kopyalarken tutar
+    while (overflow_lock_.test_and_set(std::memory_order_acquire)) {}
+    frame = overflow_frame_;
+    overflow_pending_.store(false, std::memory_order_release);
+    overflow_lock_.clear(std::memory_order_release);
+    return true;
+}
+
+void AudioCapturer::worker_loop() {
+    if (tuning_.enabled() || core::is_memory_locked()) {
+        worker_policy_.store(core::apply_thread_tuning(tuning_, "capture-worker"), std::memory_order_relaxed);
+    }
+    const size_t depth = std::max<size_t>(config_.queue_depth, 1);
+    CapturedFrame frame;
+    bool idle = true;   // Son çerçeveden sonra kuyruk boş bulundu: sonraki çerçeve bir uyanmayla gelir
+    while (worker_running_) {
+        // Taşma yuvası kuyruk boşaldıktan sonra alınır (kuyruktakilerden yenidir)
+        if (!queue_->try_pop(frame) && !take_overflow(frame)) {
+            idle = true;
+            // notify kilitsiz yapıldığı için kaçan uyandırmalar kısa timeout ile telafi edilir
+            std::unique_lock<std::mutex> lock(worker_mutex_);
+            worker_cv_.wait_for(lock, std::chrono::milliseconds(5), [this] {
+                return !worker_running_ || !queue_->empty() || overflow_pending_.load(std::memory_order_acquire);
+            });
+            continue;
+        }
+        if (idle) {
+            wakeup_lateness_.record(std::chrono::steady_clock::now() - frame.timestamp);
+            idle = false;
+        }
+
+        // DropOldest: bekleyen çerçeve sayısı derinliği aşıyorsa en eskiler atılır, en yeniler kalır
+        if (config_.overflow_policy == OverflowPolicy::DropOldest) {
+            auto waiting = [this] {
+                return queue_->size() + (overflow_pending_.load(std::memory_order_acquire) ? 1 : 0);
+            };
+            while (1 + waiting() > depth && queue_->try_pop(frame)) {
+                frames_dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        worker_frame_.assign(frame.samples.begin(), frame.samples.begin() + frame.sample_count);
+        current_frame_timestamp_ = frame.timestamp;
+        user_callback_(worker_frame_);
+        record_latency(frame.timestamp);
+    }
+}
+
+void AudioCapturer::record_latency(std::chrono::steady_clock::time_point captured_at) {
+    auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - captured_at).count();
+    uint64_t latency_ns = static_cast<uint64_t>(latency);
+    frames_processed_.fetch_add(1, std::memory_order_relaxed);
+    latency_sum_ns_.fetch_add(latency_ns, std::memory_order_relaxed);
+    uint64_t current_max = max_latency_ns_.load(std::memory_order_relaxed);
+    while (latency_ns > current_max &&
+           !max_latency_ns_.compare_exchange_weak(current_max, latency_ns, std::memory_order_relaxed)) {}
+}
 }
\ No newline at end of file
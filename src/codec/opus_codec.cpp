@@ -1,10 +1,14 @@
 #include "codec/opus_codec.hpp"
 #include <iostream>
 #include <stdexcept>
+#include <string>
 
 namespace codec {
-    OpusCodec::OpusCodec(int sample_rate, int channels)
-        : sample_rate_(sample_rate), channels_(channels), frame_size_(sample_rate / 100) {
+    OpusCodec::OpusCodec(int sample_rate, int channels, int frame_duration_ms)
+        : sample_rate_(sample_rate), channels_(channels), frame_size_(sample_rate * frame_duration_ms / 1000) {
+        if (!is_valid_frame_duration(frame_duration_ms)) {
+            throw std::invalid_argument("Opus çerçeve süresi 10, 20, 40 veya 60 ms olmalı: " + std::to_string(frame_duration_ms));
+        }
         int error;
         encoder_ = opus_encoder_create(sample_rate_, channels_, OPUS_APPLICATION_VOIP, &error);
         if (error != OPUS_OK) { throw std::runtime_error("Opus encoder oluşturulamadı: " + std::string(opus_strerror(error))); }
@@ -12,54 +16,133 @@ namespace codec {
         decoder_ = opus_decoder_create(sample_rate_, channels_, &error);
         if (error != OPUS_OK) { opus_encoder_destroy(encoder_); throw std::runtime_error("Opus decoder oluşturulamadı: " + std::string(opus_strerror(error))); }
         
-        // Encoder optimizasyonları
-        opus_encoder_ctl(encoder_, OPUS_SET_BITRATE(64000));  // 64kbps optimal voice için
+        // Encoder optimizasyonları; bitrate, complexity ve FEC başlangıç değerleri
+        // EncoderSettings'ten gelir (64kbps, complexity 5, FEC açık, %5 kayıp) ve çalışırken değişebilir
         opus_encoder_ctl(encoder_, OPUS_SET_VBR(1));         // Variable bitrate
         opus_encoder_ctl(encoder_, OPUS_SET_VBR_CONSTRAINT(1)); // Constrained VBR
-        opus_encoder_ctl(encoder_, OPUS_SET_COMPLEXITY(5));   // Orta seviye complexity
         opus_encoder_ctl(encoder_, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE)); // Voice optimizasyonu
         opus_encoder_ctl(encoder_, OPUS_SET_DTX(1));         // Discontinuous transmission
-        opus_encoder_ctl(encoder_, OPUS_SET_PACKET_LOSS_PERC(5)); // %5 packet loss tolerance
+        settings_pending_.store(true, std::memory_order_release);
+        apply_pending_settings();
         
         std::cout << "Opus codec başarıyla başlatıldı (Optimized)." << std::endl;
     }
 
+    bool OpusCodec::is_valid(const EncoderSettings& settings) {
+        return settings.bitrate >= 6000 && settings.bitrate <= 510000 &&
+               settings.complexity >= 0 && settings.complexity <= 10 &&
+               settings.expected_loss_percent >= 0 && settings.expected_loss_percent <= 100;
+    }
+
+    bool OpusCodec::set_bitrate(int bits_per_second) {
+        EncoderSettings updated = settings();
+        updated.bitrate = bits_per_second;
+        return apply_settings(updated);
+    }
+
+    bool OpusCodec::set_complexity(int complexity) {
+        EncoderSettings updated = settings();
+        updated.complexity = complexity;
+        return apply_settings(updated);
+    }
+
+    bool OpusCodec::apply_settings(const EncoderSettings& settings) {
+        if (!is_valid(settings)) { return false; }
+        {
+            std::lock_guard<std::mutex> lock(settings_mutex_);
+            requested_settings_ = settings;
+        }
+        settings_pending_.store(true, std::memory_order_release);
+        return true;
+    }
+
+    EncoderSettings OpusCodec::settings() const {
+        std::lock_guard<std::mutex> lock(settings_mutex_);
+        return requested_settings_;
+    }
+
+    void OpusCodec::apply_pending_settings() {
+        if (!settings_pending_.exchange(false, std::memory_order_acq_rel)) { return; }
+        EncoderSettings settings;
+        {
+            std::lock_guard<std::mutex> lock(settings_mutex_);
+            settings = requested_settings_;
+        }
+        opus_encoder_ctl(encoder_, OPUS_SET_BITRATE(settings.bitrate));
+        opus_encoder_ctl(encoder_, OPUS_SET_COMPLEXITY(settings.complexity));
+        opus_encoder_ctl(encoder_, OPUS_SET_INBAND_FEC(settings.inband_fec ? 1 : 0));
+        opus_encoder_ctl(encoder_, OPUS_SET_PACKET_LOSS_PERC(settings.expected_loss_percent));
+    }
+
     OpusCodec::~OpusCodec() {
         if (encoder_) { opus_encoder_destroy(encoder_); }
         if (decoder_) { opus_decoder_destroy(decoder_); }
         std::cout << "Opus codec temizlendi." << std::endl;
     }
 
-    std::vector<uint8_t> OpusCodec::encode(const std::vector<int16_t>& pcm_data) {
-        if (!encoder_ || pcm_data.empty()) { return {}; }
-        
-        // Frame size kontrolü - Opus 10ms frameler bekler
-        if (static_cast<int>(pcm_data.size()) != frame_size_ * channels_) {
+    size_t OpusCodec::encode(const int16_t* pcm_data, size_t sample_count, uint8_t* out, size_t out_capacity) {
+        if (!encoder_ || !pcm_data || sample_count == 0 || !out || out_capacity == 0) { return 0; }
+
+        // Frame size kontrolü - yapılandırılan çerçeve süresi kadar sample beklenir
+        if (static_cast<int>(sample_count) != frame_size_ * channels_) {
             std::cerr << "UYARI: PCM data boyutu beklenen frame size ile uyuşmuyor. "
-                      << "Beklenen: " << (frame_size_ * channels_) 
-                      << ", Gelen: " << pcm_data.size() << std::endl;
-            return {};
+                      << "Beklenen: " << (frame_size_ * channels_)
+                      << ", Gelen: " << sample_count << std::endl;
+            return 0;
         }
-        
-        std::vector<uint8_t> compressed_data(4000); // Max Opus packet size
-        opus_int32 result = opus_encode(encoder_, pcm_data.data(), frame_size_, 
-                                       compressed_data.data(), compressed_data.size());
-        
-        if (result < 0) { 
-            std::cerr << "Opus encode hatası: " << opus_strerror(result) << std::endl; 
-            return {}; 
+
+        apply_pending_settings();
+        opus_int32 result = opus_encode(encoder_, pcm_data, frame_size_, out, static_cast<opus_int32>(out_capacity));
+        if (result < 0) {
+            std::cerr << "Opus encode hatası: " << opus_strerror(result) << std::endl;
+            return 0;
         }
-        
-        compressed_data.resize(result);
+        return static_cast<size_t>(result);
+    }
+
+    size_t OpusCodec::decode(const uint8_t* encoded_data, size_t size, int16_t* out, size_t out_capacity) {
+        if (!decoder_ || !encoded_data || size == 0 || !out) { return 0; }
+        const int max_samples = static_cast<int>(out_capacity / channels_);
+        int decoded_samples = opus_decode(decoder_, encoded_data, static_cast<opus_int32>(size), out, max_samples, 0);
+        if (decoded_samples < 0) { std::cerr << "Opus decode hatası: " << opus_strerror(decoded_samples) << std::endl; return 0; }
+        return static_cast<size_t>(decoded_samples * channels_);
+    }
+
+    size_t OpusCodec::decode_lost(const uint8_t* next_data, size_t next_size, int16_t* out, size_t out_capacity) {
+        if (!decoder_ || !out) { return 0; }
+
+        // Gizlenecek süre son paketin süresi kadar olmalı (2.5ms katları)
+        opus_int32 lost_samples = 0;
+        opus_decoder_ctl(decoder_, OPUS_GET_LAST_PACKET_DURATION(&lost_samples));
+        if (lost_samples <= 0 || lost_samples > sample_rate_ / 100 * MAX_FRAME_MULTIPLIER) { lost_samples = frame_size_; }
+        if (static_cast<size_t>(lost_samples * channels_) > out_capacity) { return 0; }
+
+        int decoded_samples;
+        if (next_data && next_size > 0) {
+            // Bir sonraki paketin içindeki FEC verisinden kayıp çerçeveyi üret
+            decoded_samples = opus_decode(decoder_, next_data, static_cast<opus_int32>(next_size), out, lost_samples, 1);
+        } else {
+            decoded_samples = opus_decode(decoder_, nullptr, 0, out, lost_samples, 0);
+        }
+        if (decoded_samples < 0) { std::cerr << "Opus PLC hatası: " << opus_strerror(decoded_samples) << std::endl; return 0; }
+        return static_cast<size_t>(decoded_samples * channels_);
+    }
+
+    std::vector<uint8_t> OpusCodec::encode(const std::vector<int16_t>& pcm_data) {
+        std::vector<uint8_t> compressed_data(MAX_PACKET_SIZE);
+        compressed_data.resize(encode(pcm_data.data(), pcm_data.size(), compressed_data.data(), compressed_data.size()));
         return compressed_data;
     }
 
     std::vector<int16_t> OpusCodec::decode(const std::vector<uint8_t>& encoded_data) {
-        if (!decoder_ || encoded_data.empty()) { return {}; }
-        std::vector<int16_t> decoded_data(frame_size_ * channels_ * 6);
-        int decoded_samples = opus_decode(decoder_, encoded_data.data(), encoded_data.size(), decoded_data.data(), frame_size_ * 6, 0);
-        if (decoded_samples < 0) { std::cerr << "Opus decode hatası: " << opus_strerror(decoded_samples) << std::endl; return {}; }
-        decoded_data.resize(decoded_samples * channels_);
+        std::vector<int16_t> decoded_data(max_decoded_samples());
+        decoded_data.resize(decode(encoded_data.data(), encoded_data.size(), decoded_data.data(), decoded_data.size()));
+        return decoded_data;
+    }
+
+    std::vector<int16_t> OpusCodec::decode_lost(const std::vector<uint8_t>& next_data) {
+        std::vector<int16_t> decoded_data(max_decoded_samples());
+        decoded_data.resize(decode_lost(next_data.data(), next_data.size(), decoded_data.data(), decoded_data.size()));
         return decoded_data;
     }
-}
\ No newline at end of file
+}
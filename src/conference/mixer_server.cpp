@@ -0,0 +1,358 @@
+#include "conference/mixer_server.hpp"
+#include "core/spsc_ring_buffer.hpp"
+#include "streaming/collector.hpp"
+#include "streaming/slicer.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace conference {
+
+namespace {
+    int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    constexpr size_t MAX_SLICE_SIZE = 1000;
+}
+
+struct MixerServer::Participant {
+    struct InboxFrame {
+        uint16_t size;
+        bool lost;
+        uint8_t data[streaming::Collector::MAX_PAYLOAD_SIZE];
+    };
+    static constexpr size_t INBOX_DEPTH = 16;
+    static constexpr size_t MAX_BACKLOG = 4; // 40ms üzeri birikmeyi at (gecikme sınırı)
+    static constexpr int OWN_STREAM_HANGOVER_TICKS = 30; // Susunca 300ms kendi encoder'ında kalır
+
+    Participant(uint32_t participant_ssrc, const sockaddr_in& source)
+        : ssrc(participant_ssrc), address(source), inbox(INBOX_DEPTH) {
+        pcm.resize(codec.max_decoded_samples() + FRAME_SAMPLES);
+        encoded.resize(codec::OpusCodec::MAX_PACKET_SIZE);
+        out_packets.reserve(4);
+        collector.set_loss_callback([this](const std::vector<uint8_t>& next_data) { push(next_data, true); });
+    }
+
+    // Döngü thread'i: jitter buffer'dan çıkan çerçeveyi mix tick'ine aktarır
+    void push(const std::vector<uint8_t>& payload, bool lost) {
+        InboxFrame frame;
+        frame.size = static_cast<uint16_t>(std::min(payload.size(), sizeof(frame.data)));
+        frame.lost = lost;
+        std::copy(payload.begin(), payload.begin() + frame.size, frame.data);
+        inbox.try_push(frame);
+    }
+
+    const uint32_t ssrc;
+    sockaddr_in address;                     // participants_mutex_ ile korunur
+    sockaddr_in destination{};               // Tick başında address'ten kopyalanır
+    std::atomic<int64_t> last_seen_ns{0};
+
+    streaming::Collector collector;          // Yalnızca döngü thread'i
+    core::SpscRingBuffer<InboxFrame> inbox;  // Döngü thread'i -> mix tick'in decode işleri
+
+    // Yalnızca mix tick (tek seferde tek pool thread'i)
+    codec::OpusCodec codec;
+    std::vector<int16_t> pcm;
+    size_t pcm_available = 0;
+    bool has_audio = false;
+    // Konuşmayı bırakan katılımcı hangover boyunca kendi encoder'ıyla tam karışımı (ortak encoder'ın
+    // girdisinin aynısı) encode eder; iki encoder durumu yakınsadıktan sonra ortak akışa geri döner
+    int own_stream_ticks = 0;
+    bool on_own_encoder = false;             // Önceki tick'te kendi encoder'ıyla gönderdi
+    std::vector<uint8_t> encoded;
+    streaming::Slicer slicer;
+    uint32_t out_timestamp = 0;
+    bool was_sending = false;
+    std::vector<core::PacketView> out_packets;
+};
+
+MixerServer::MixerServer(const Config& config)
+    : config_(config),
+      receiver_(&loop_),
+      pool_(config.worker_threads, config.realtime.processing),
+      mix_sum_(FRAME_SAMPLES),
+      shared_mix_(FRAME_SAMPLES),
+      shared_encoded_(codec::OpusCodec::MAX_PACKET_SIZE),
+      shared_codec_(std::make_unique<codec::OpusCodec>(SAMPLE_RATE, 1)) {
+    active_.reserve(config_.max_participants);
+    outgoing_packets_.reserve(config_.max_participants * 2);
+    outgoing_destinations_.reserve(config_.max_participants * 2);
+}
+
+MixerServer::~MixerServer() {
+    stop();
+}
+
+bool MixerServer::start() {
+    if (is_running_) { return true; }
+    if (config_.realtime.lock_memory) {
+        core::lock_process_memory();
+    }
+    loop_.set_thread_tuning(config_.realtime.network, "mixer-loop");
+    loop_.start();
+    sender_.set_backend(config_.io_backend);
+    receiver_.set_backend(config_.io_backend);
+    if (!sender_.open() || !sender_.attach(&loop_)) {
+        std::cerr << "HATA: Mixer gönderim soketi açılamadı." << std::endl;
+        return false;
+    }
+    auto datagram_callback = [this](const uint8_t* data, size_t size, const sockaddr_in& source) {
+        on_datagram(data, size, source);
+    };
+    if (!receiver_.start_raw(config_.port, datagram_callback)) {
+        std::cerr << "HATA: Mixer " << config_.port << " portunu dinleyemedi." << std::endl;
+        return false;
+    }
+    is_running_ = true;
+    const auto tick = std::chrono::milliseconds(10);
+    tick_timer_ = loop_.add_timer(tick, [this] { on_tick(); }, tick);
+    std::cout << "Konferans mikseri " << config_.port << " portunda başladı ("
+              << pool_.size() << " thread)." << std::endl;
+    return true;
+}
+
+void MixerServer::stop() {
+    if (!is_running_) { return; }
+    is_running_ = false;
+    receiver_.stop();
+    loop_.cancel_timer(tick_timer_);
+    loop_.stop();
+    std::cout << "Konferans mikseri durduruldu." << std::endl;
+}
+
+MixerServer::Stats MixerServer::get_stats() const {
+    Stats stats;
+    {
+        std::lock_guard<std::mutex> lock(participants_mutex_);
+        stats.participants = participants_.size();
+    }
+    stats.ticks = ticks_.load(std::memory_order_relaxed);
+    stats.frames_decoded = frames_decoded_.load(std::memory_order_relaxed);
+    stats.frames_concealed = frames_concealed_.load(std::memory_order_relaxed);
+    stats.mixes_encoded = mixes_encoded_.load(std::memory_order_relaxed);
+    stats.speakers_mixed = speakers_mixed_.load(std::memory_order_relaxed);
+    stats.max_tick_encodes = max_tick_encodes_.load(std::memory_order_relaxed);
+    stats.packets_sent = packets_sent_.load(std::memory_order_relaxed);
+    stats.rejected_joins = rejected_joins_.load(std::memory_order_relaxed);
+    stats.max_tick_ns = max_tick_ns_.load(std::memory_order_relaxed);
+    stats.loop_policy = loop_.get_stats().sched_policy;
+    const auto lateness = loop_.wakeup_lateness();
+    stats.tick_lateness_p99_ns = lateness.percentile(0.99);
+    stats.tick_lateness_max_ns = lateness.max;
+    if (stats.ticks > 0) {
+        stats.avg_tick_ns = tick_time_sum_ns_.load(std::memory_order_relaxed) / stats.ticks;
+    }
+    return stats;
+}
+
+void MixerServer::on_datagram(const uint8_t* data, size_t size, const sockaddr_in& source) {
+    core::PacketView packet;
+    if (!core::PacketView::parse(data, size, packet)) { return; }
+    // SID paketleri katılımcıyı canlı tutar ve sessizlik boşluğunun gizlenmesini engeller;
+    // miksere katkıları yoktur (Collector'da sessizlik callback'i bağlı değil)
+    if (packet.payload_type != core::PAYLOAD_TYPE_OPUS && packet.payload_type != core::PAYLOAD_TYPE_CN) { return; }
+
+    auto participant = find_or_add(packet.ssrc, source);
+    if (!participant) { return; }
+
+    participant->last_seen_ns.store(now_ns(), std::memory_order_relaxed);
+    Participant* p = participant.get();
+    participant->collector.collect(packet, [p](const std::vector<uint8_t>& payload) { p->push(payload, false); });
+}
+
+std::shared_ptr<MixerServer::Participant> MixerServer::find_or_add(uint32_t ssrc, const sockaddr_in& source) {
+    sockaddr_in address = source;
+    if (config_.reply_port > 0) {
+        address.sin_port = htons(static_cast<uint16_t>(config_.reply_port));
+    }
+
+    std::lock_guard<std::mutex> lock(participants_mutex_);
+    auto it = participants_.find(ssrc);
+    if (it != participants_.end()) {
+        // Adres değiştiyse (NAT yeniden bağlama vb.) yeni adrese cevap ver
+        if (it->second->address.sin_addr.s_addr != address.sin_addr.s_addr ||
+            it->second->address.sin_port != address.sin_port) {
+            it->second->address = address;
+        }
+        return it->second;
+    }
+    if (participants_.size() >= config_.max_participants) {
+        rejected_joins_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    auto participant = std::make_shared<Participant>(ssrc, address);
+    participants_.emplace(ssrc, participant);
+    std::cout << "Katılımcı eklendi: SSRC " << ssrc << " (" << participants_.size() << " kişi)" << std::endl;
+    return participant;
+}
+
+void MixerServer::on_tick() {
+    // Periyodik döngü zamanlayıcısı: geride kalınırsa kaçırılan tick'ler toplu çalıştırılmaz
+    const int64_t started = now_ns();
+    mix_tick();
+    const uint64_t elapsed = static_cast<uint64_t>(now_ns() - started);
+
+    ticks_.fetch_add(1, std::memory_order_relaxed);
+    tick_time_sum_ns_.fetch_add(elapsed, std::memory_order_relaxed);
+    if (elapsed > max_tick_ns_.load(std::memory_order_relaxed)) {
+        max_tick_ns_.store(elapsed, std::memory_order_relaxed);
+    }
+}
+
+void MixerServer::mix_tick() {
+    // 1. Aktif katılımcıların anlık görüntüsü; zaman aşımına uğrayanlar çıkarılır
+    active_.clear();
+    {
+        const int64_t timeout_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(config_.participant_timeout).count();
+        const int64_t now = now_ns();
+        std::lock_guard<std::mutex> lock(participants_mutex_);
+        for (auto it = participants_.begin(); it != participants_.end();) {
+            if (now - it->second->last_seen_ns.load(std::memory_order_relaxed) > timeout_ns) {
+                std::cout << "Katılımcı zaman aşımı: SSRC " << it->first << std::endl;
+                it = participants_.erase(it);
+                continue;
+            }
+            it->second->destination = it->second->address;
+            active_.push_back(it->second);
+            ++it;
+        }
+    }
+    if (active_.empty()) { return; }
+
+    // Bu tick'e kadar deadline'ı dolan kayıplar gizlenir (paket gelmese de)
+    for (auto& participant : active_) {
+        Participant* p = participant.get();
+        p->collector.poll([p](const std::vector<uint8_t>& payload) { p->push(payload, false); });
+    }
+
+    // 2. Paralel decode: her katılımcının bu tick'e ait 10ms PCM'i
+    pool_.parallel_for(active_.size(), [this](size_t index) {
+        Participant& p = *active_[index];
+        while (p.pcm_available < static_cast<size_t>(FRAME_SAMPLES)) {
+            const size_t backlog = p.inbox.size();
+            if (backlog > Participant::MAX_BACKLOG) {
+                p.inbox.discard(backlog - Participant::MAX_BACKLOG);
+            }
+            Participant::InboxFrame frame;
+            if (!p.inbox.try_pop(frame)) { break; }
+
+            int16_t* out = p.pcm.data() + p.pcm_available;
+            const size_t capacity = p.pcm.size() - p.pcm_available;
+            size_t decoded;
+            if (frame.lost) {
+                decoded = p.codec.decode_lost(frame.size > 0 ? frame.data : nullptr, frame.size, out, capacity);
+                frames_concealed_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                decoded = p.codec.decode(frame.data, frame.size, out, capacity);
+                frames_decoded_.fetch_add(1, std::memory_order_relaxed);
+            }
+            p.pcm_available += decoded;
+        }
+        p.has_audio = p.pcm_available >= static_cast<size_t>(FRAME_SAMPLES);
+    });
+
+    // 3. Toplam karışım (int32, doygunluk encode öncesi)
+    std::fill(mix_sum_.begin(), mix_sum_.end(), 0);
+    size_t contributors = 0;
+    for (const auto& participant : active_) {
+        if (!participant->has_audio) { continue; }
+        ++contributors;
+        const int16_t* pcm = participant->pcm.data();
+        for (int i = 0; i < FRAME_SAMPLES; ++i) {
+            mix_sum_[i] += pcm[i];
+        }
+    }
+
+    // 4. Katkısı olmayan (ve hangover'ı bitmiş) herkes aynı karışımı duyar: bir kez encode et
+    shared_encoded_size_ = 0;
+    std::atomic<size_t> tick_encodes{0};
+    const bool shared_needed = contributors > 0 &&
+        std::any_of(active_.begin(), active_.end(), [](const std::shared_ptr<Participant>& participant) {
+            return !participant->has_audio && participant->own_stream_ticks == 0;
+        });
+    if (shared_needed) {
+        for (int i = 0; i < FRAME_SAMPLES; ++i) {
+            shared_mix_[i] = static_cast<int16_t>(std::clamp<int32_t>(mix_sum_[i], -32768, 32767));
+        }
+        shared_encoded_size_ = shared_codec_->encode(shared_mix_.data(), shared_mix_.size(),
+                                                     shared_encoded_.data(), shared_encoded_.size());
+        tick_encodes.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 5. Paralel mix-minus encode ve paketleme
+    pool_.parallel_for(active_.size(), [this, contributors, &tick_encodes](size_t index) {
+        Participant& p = *active_[index];
+        p.out_packets.clear();
+
+        const uint8_t* payload = nullptr;
+        size_t payload_size = 0;
+        bool encoder_switched = false;
+        if (p.has_audio) {
+            p.own_stream_ticks = Participant::OWN_STREAM_HANGOVER_TICKS;
+        }
+        if (contributors > 0) {
+            if (p.own_stream_ticks > 0) {
+                // Kendi sesi çıkarılmış karışım (katkı yoksa tam karışım, aynı encoder'la)
+                int16_t mix_minus[FRAME_SAMPLES];
+                for (int i = 0; i < FRAME_SAMPLES; ++i) {
+                    const int32_t own = p.has_audio ? p.pcm[i] : 0;
+                    mix_minus[i] = static_cast<int16_t>(std::clamp<int32_t>(mix_sum_[i] - own, -32768, 32767));
+                }
+                payload_size = p.codec.encode(mix_minus, FRAME_SAMPLES, p.encoded.data(), p.encoded.size());
+                payload = p.encoded.data();
+                if (!p.has_audio) { --p.own_stream_ticks; }
+                p.on_own_encoder = true;
+                tick_encodes.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                payload = shared_encoded_.data();
+                payload_size = shared_encoded_size_;
+                encoder_switched = p.on_own_encoder;
+                p.on_own_encoder = false;
+            }
+        } else if (!p.has_audio && p.own_stream_ticks > 0) {
+            --p.own_stream_ticks;   // Kimse konuşmuyor: hangover yine de işler
+        }
+
+        if (payload_size > 0) {
+            // Ortak encoder'a geçiş yeni talkspurt olarak işaretlenir (marker): alıcı farklı encoder
+            // durumundan gelen ilk paketi süreklilik beklemeden karşılar
+            const bool marker = !p.was_sending || encoder_switched;
+            p.slicer.slice(payload, payload_size, MAX_SLICE_SIZE, p.out_timestamp, marker, p.out_packets);
+            p.was_sending = true;
+        } else {
+            p.was_sending = false;
+        }
+        p.out_timestamp += FRAME_SAMPLES;
+
+        // Kullanılan 10ms'i PCM tamponundan çıkar
+        if (p.has_audio) {
+            std::copy(p.pcm.begin() + FRAME_SAMPLES, p.pcm.begin() + p.pcm_available, p.pcm.begin());
+            p.pcm_available -= FRAME_SAMPLES;
+        }
+    });
+
+    // Tick başına encode ≈ konuşan + hangover'daki katılımcılar + 1 (ortak karışım)
+    const size_t encodes = tick_encodes.load(std::memory_order_relaxed);
+    mixes_encoded_.fetch_add(encodes, std::memory_order_relaxed);
+    speakers_mixed_.fetch_add(contributors, std::memory_order_relaxed);
+    if (encodes > max_tick_encodes_.load(std::memory_order_relaxed)) {
+        max_tick_encodes_.store(encodes, std::memory_order_relaxed);
+    }
+
+    // 6. Tüm katılımcıların paketleri tek batch'te (sendmmsg) gönderilir
+    outgoing_packets_.clear();
+    outgoing_destinations_.clear();
+    for (const auto& participant : active_) {
+        for (const auto& packet : participant->out_packets) {
+            outgoing_packets_.push_back(packet);
+            outgoing_destinations_.push_back(participant->destination);
+        }
+    }
+    if (!outgoing_packets_.empty()) {
+        sender_.send_to(outgoing_packets_, outgoing_destinations_);
+        packets_sent_.fetch_add(outgoing_packets_.size(), std::memory_order_relaxed);
+    }
+}
+
+}
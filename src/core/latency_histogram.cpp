@@ -0,0 +1,59 @@
+#include "core/latency_histogram.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace core {
+    uint64_t LatencyHistogram::bucket_lower_bound(size_t index) {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+        const size_t shift = index / SUB_BUCKETS - 1;
+        const uint64_t sub = index % SUB_BUCKETS;
+        return (SUB_BUCKETS + sub) << shift;
+    }
+
+    uint64_t LatencyHistogram::bucket_width(size_t index) {
+        if (index < SUB_BUCKETS) {
+            return 1;
+        }
+        return uint64_t(1) << (index / SUB_BUCKETS - 1);
+    }
+
+    LatencyHistogram::Snapshot LatencyHistogram::snapshot() const {
+        Snapshot snapshot;
+        snapshot.buckets.resize(BUCKET_COUNT);
+        uint64_t total = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+            total += snapshot.buckets[i];
+        }
+        snapshot.count = total;
+        snapshot.sum = sum_.load(std::memory_order_relaxed);
+        snapshot.max = max_.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+
+    void LatencyHistogram::reset() {
+        for (auto& bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        sum_.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t LatencyHistogram::Snapshot::percentile(double p) const {
+        if (count == 0 || buckets.empty()) {
+            return 0;
+        }
+        p = std::min(1.0, std::max(0.0, p));
+        const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p * static_cast<double>(count))));
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < buckets.size(); ++i) {
+            cumulative += buckets[i];
+            if (cumulative >= target) {
+                return std::min(max, bucket_lower_bound(i) + bucket_width(i) / 2);
+            }
+        }
+        return max;
+    }
+}
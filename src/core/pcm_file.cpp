@@ -0,0 +1,138 @@
+#include "core/pcm_file.hpp"
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <cctype>
+#include <iterator>
+
+namespace core {
+namespace {
+    bool has_wav_extension(const std::string& path) {
+        if (path.size() < 4) { return false; }
+        std::string ext = path.substr(path.size() - 4);
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return ext == ".wav";
+    }
+
+    uint16_t read_u16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+    uint32_t read_u32(const uint8_t* p) {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+    void write_u16(std::ostream& out, uint16_t v) {
+        const char bytes[2] = {static_cast<char>(v & 0xFF), static_cast<char>(v >> 8)};
+        out.write(bytes, 2);
+    }
+    void write_u32(std::ostream& out, uint32_t v) {
+        const char bytes[4] = {static_cast<char>(v & 0xFF), static_cast<char>((v >> 8) & 0xFF),
+                               static_cast<char>((v >> 16) & 0xFF), static_cast<char>(v >> 24)};
+        out.write(bytes, 4);
+    }
+
+    void bytes_to_samples(const uint8_t* data, size_t size, std::vector<int16_t>& samples) {
+        samples.resize(size / 2);
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = static_cast<int16_t>(read_u16(data + 2 * i));
+        }
+    }
+
+    bool parse_wav(const std::vector<uint8_t>& bytes, PcmAudio& audio) {
+        if (bytes.size() < 12 || std::memcmp(bytes.data(), "RIFF", 4) != 0 || std::memcmp(bytes.data() + 8, "WAVE", 4) != 0) {
+            std::cerr << "HATA: Geçersiz WAV başlığı." << std::endl;
+            return false;
+        }
+        bool have_format = false;
+        size_t offset = 12;
+        while (offset + 8 <= bytes.size()) {
+            const uint8_t* chunk = bytes.data() + offset;
+            const uint32_t chunk_size = read_u32(chunk + 4);
+            const size_t body = offset + 8;
+            const size_t available = std::min<size_t>(chunk_size, bytes.size() - body);
+
+            if (std::memcmp(chunk, "fmt ", 4) == 0 && available >= 16) {
+                const uint16_t format = read_u16(chunk + 8);
+                const uint16_t bits = read_u16(chunk + 22);
+                // 1: PCM, 0xFFFE: WAVE_FORMAT_EXTENSIBLE (alt format PCM varsayılır)
+                if ((format != 1 && format != 0xFFFE) || bits != 16) {
+                    std::cerr << "HATA: Yalnızca 16 bit PCM WAV desteklenir (format " << format
+                              << ", " << bits << " bit)." << std::endl;
+                    return false;
+                }
+                audio.channels = read_u16(chunk + 10);
+                audio.sample_rate = static_cast<int>(read_u32(chunk + 12));
+                have_format = true;
+            } else if (std::memcmp(chunk, "data", 4) == 0) {
+                if (!have_format) {
+                    std::cerr << "HATA: WAV data bölümü fmt bölümünden önce geldi." << std::endl;
+                    return false;
+                }
+                bytes_to_samples(bytes.data() + body, available, audio.samples);
+                return audio.channels > 0;
+            }
+            offset = body + chunk_size + (chunk_size & 1); // Bölümler çift sınıra hizalıdır
+        }
+        std::cerr << "HATA: WAV data bölümü bulunamadı." << std::endl;
+        return false;
+    }
+}
+
+bool read_pcm_file(const std::string& path, PcmAudio& audio) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "HATA: Dosya açılamadı: " << path << std::endl;
+        return false;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (has_wav_extension(path)) {
+        return parse_wav(bytes, audio);
+    }
+    bytes_to_samples(bytes.data(), bytes.size(), audio.samples);
+    return true;
+}
+
+bool write_pcm_file(const std::string& path, const PcmAudio& audio) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "HATA: Dosya yazılamadı: " << path << std::endl;
+        return false;
+    }
+    const uint32_t data_size = static_cast<uint32_t>(audio.samples.size() * sizeof(int16_t));
+    if (has_wav_extension(path)) {
+        const uint16_t channels = static_cast<uint16_t>(audio.channels);
+        const uint32_t rate = static_cast<uint32_t>(audio.sample_rate);
+        file.write("RIFF", 4);
+        write_u32(file, 36 + data_size);
+        file.write("WAVEfmt ", 8);
+        write_u32(file, 16);
+        write_u16(file, 1);
+        write_u16(file, channels);
+        write_u32(file, rate);
+        write_u32(file, rate * channels * 2);
+        write_u16(file, static_cast<uint16_t>(channels * 2));
+        write_u16(file, 16);
+        file.write("data", 4);
+        write_u32(file, data_size);
+    }
+    for (int16_t sample : audio.samples) {
+        write_u16(file, static_cast<uint16_t>(sample));
+    }
+    return static_cast<bool>(file);
+}
+
+void downmix_to_mono(PcmAudio& audio) {
+    if (audio.channels <= 1) { return; }
+    const size_t channels = static_cast<size_t>(audio.channels);
+    const size_t frames = audio.samples.size() / channels;
+    for (size_t i = 0; i < frames; ++i) {
+        int32_t sum = 0;
+        for (size_t c = 0; c < channels; ++c) {
+            sum += audio.samples[i * channels + c];
+        }
+        audio.samples[i] = static_cast<int16_t>(sum / static_cast<int32_t>(channels));
+    }
+    audio.samples.resize(frames);
+    audio.channels = 1;
+}
+}
@@ -0,0 +1,163 @@
+#include "core/realtime.hpp"
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <errno.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace core {
+    namespace {
+        std::atomic<bool> memory_locked{false};
+    }
+
+    const char* sched_policy_name(SchedPolicy policy) {
+        switch (policy) {
+            case SchedPolicy::Default:    return "default";
+            case SchedPolicy::Fifo:       return "fifo";
+            case SchedPolicy::RoundRobin: return "rr";
+        }
+        return "?";
+    }
+
+    bool parse_sched_policy(const char* name, SchedPolicy& policy) {
+        const SchedPolicy candidates[] = {SchedPolicy::Default, SchedPolicy::Fifo, SchedPolicy::RoundRobin};
+        for (SchedPolicy candidate : candidates) {
+            if (std::strcmp(name, sched_policy_name(candidate)) == 0) {
+                policy = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool parse_cpu_list(const char* text, std::vector<int>& cpus) {
+        std::vector<int> parsed;
+        const char* cursor = text;
+        while (*cursor) {
+            char* end = nullptr;
+            const long first = std::strtol(cursor, &end, 10);
+            if (end == cursor || first < 0) { return false; }
+            long last = first;
+            cursor = end;
+            if (*cursor == '-') {
+                ++cursor;
+                last = std::strtol(cursor, &end, 10);
+                if (end == cursor || last < first) { return false; }
+                cursor = end;
+            }
+            for (long cpu = first; cpu <= last; ++cpu) {
+                parsed.push_back(static_cast<int>(cpu));
+            }
+            if (*cursor == ',') {
+                ++cursor;
+                if (*cursor == '\0') { return false; }
+            } else if (*cursor != '\0') {
+                return false;
+            }
+        }
+        if (parsed.empty()) { return false; }
+        std::sort(parsed.begin(), parsed.end());
+        parsed.erase(std::unique(parsed.begin(), parsed.end()), parsed.end());
+        cpus = std::move(parsed);
+        return true;
+    }
+
+    SchedPolicy apply_thread_tuning(const ThreadTuning& tuning, const char* thread_name) {
+        SchedPolicy applied = SchedPolicy::Default;
+#ifdef __linux__
+        const char* label = thread_name ? thread_name : "?";
+        if (thread_name) {
+            char name[16];
+            std::strncpy(name, thread_name, sizeof(name) - 1);
+            name[sizeof(name) - 1] = '\0';
+            pthread_setname_np(pthread_self(), name);
+        }
+        if (!tuning.cpus.empty()) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (int cpu : tuning.cpus) {
+                if (cpu < CPU_SETSIZE) { CPU_SET(cpu, &set); }
+            }
+            const int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+            if (error != 0) {
+                std::cerr << "UYARI: " << label << " thread'i CPU kümesine bağlanamadı - "
+                          << strerror(error) << std::endl;
+            }
+        }
+        if (tuning.policy != SchedPolicy::Default) {
+            const int policy = tuning.policy == SchedPolicy::Fifo ? SCHED_FIFO : SCHED_RR;
+            sched_param param{};
+            param.sched_priority = std::clamp(tuning.priority, sched_get_priority_min(policy), sched_get_priority_max(policy));
+            const int error = pthread_setschedparam(pthread_self(), policy, &param);
+            if (error == 0) {
+                applied = tuning.policy;
+            } else {
+                std::cerr << "UYARI: " << label << " thread'i için SCHED_" << (policy == SCHED_FIFO ? "FIFO" : "RR")
+                          << " ayarlanamadı - " << strerror(error)
+                          << (error == EPERM ? " (CAP_SYS_NICE veya RLIMIT_RTPRIO gerekli)" : "")
+                          << "; varsayılan zamanlama kullanılıyor" << std::endl;
+            }
+        }
+#else
+        if (tuning.enabled()) {
+            std::cerr << "UYARI: Thread zamanlama ayarları bu platformda desteklenmiyor." << std::endl;
+        }
+#endif
+        if (is_memory_locked()) {
+            prefault_stack(STACK_PREFAULT_BYTES);
+        }
+        return applied;
+    }
+
+    bool lock_process_memory() {
+#ifdef __linux__
+#ifdef __GLIBC__
+        // Serbest bırakılan bellek süreçte kalsın, büyük ayırmalar ayrı mmap ile gelmesin
+        mallopt(M_TRIM_THRESHOLD, -1);
+        mallopt(M_MMAP_MAX, 0);
+#endif
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+            const int error = errno;
+            std::cerr << "UYARI: Bellek kilitlenemedi (mlockall) - " << strerror(error)
+                      << (error == ENOMEM || error == EPERM ? " (RLIMIT_MEMLOCK yetersiz)" : "") << std::endl;
+            return false;
+        }
+        memory_locked.store(true, std::memory_order_release);
+        prefault_stack(STACK_PREFAULT_BYTES);
+        std::cout << "Süreç belleği RAM'e kilitlendi." << std::endl;
+        return true;
+#else
+        std::cerr << "UYARI: Bellek kilitleme bu platformda desteklenmiyor." << std::endl;
+        return false;
+#endif
+    }
+
+    bool is_memory_locked() {
+        return memory_locked.load(std::memory_order_acquire);
+    }
+
+    void prefault_stack(size_t bytes) {
+        // Her çağrı çerçevesi bir CHUNK'a sayfa başına bir kez yazar; yazma özyinelemeden sonra
+        // yapıldığı için çerçeveler iç içe kalır (kuyruk çağrısıyla aynı alan tekrar kullanılamaz)
+        constexpr size_t PAGE = 4096;
+        constexpr size_t CHUNK = 16 * PAGE;
+        unsigned char block[CHUNK];
+        if (bytes > CHUNK) {
+            prefault_stack(bytes - CHUNK);
+        }
+        volatile unsigned char* touch = block;
+        for (size_t offset = 0; offset < CHUNK; offset += PAGE) {
+            touch[offset] = 0;
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#include "core/thread_pool.hpp"
+#include <algorithm>
+
+namespace core {
+
+ThreadPool::ThreadPool(size_t thread_count, const ThreadTuning& tuning) {
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // Çağıran thread de iş yaptığı için bir eksik worker açılır
+    for (size_t i = 1; i < thread_count; ++i) {
+        workers_.emplace_back([this, tuning] {
+            if (tuning.enabled() || is_memory_locked()) {
+                apply_thread_tuning(tuning, "pool-worker");
+            }
+            worker_loop();
+        });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
+    }
+}
+
+void ThreadPool::parallel_for(size_t count, const std::function<void(size_t)>& task) {
+    if (count == 0) { return; }
+    if (workers_.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) { task(i); }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        task_count_ = count;
+        next_index_.store(0, std::memory_order_relaxed);
+        active_workers_ = workers_.size();
+        ++generation_;
+    }
+    start_cv_.notify_all();
+
+    run_tasks();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return active_workers_ == 0; });
+    task_ = nullptr;
+}
+
+void ThreadPool::run_tasks() {
+    size_t index;
+    while ((index = next_index_.fetch_add(1, std::memory_order_relaxed)) < task_count_) {
+        (*task_)(index);
+    }
+}
+
+void ThreadPool::worker_loop() {
+    uint64_t seen_generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_cv_.wait(lock, [&] { return stopping_ || generation_ != seen_generation; });
+            if (stopping_) { return; }
+            seen_generation = generation_;
+        }
+
+        run_tasks();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_workers_ == 0) {
+                done_cv_.notify_one();
+            }
+        }
+    }
+}
+
+}
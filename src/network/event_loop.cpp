@@ -0,0 +1,362 @@
+#include "network/event_loop.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <future>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+namespace network {
+    namespace {
+#ifdef __linux__
+        constexpr int MAX_EVENTS = 64;
+
+        uint32_t to_epoll(uint32_t events) {
+            uint32_t result = 0;
+            if (events & EventLoop::READABLE) { result |= EPOLLIN; }
+            if (events & EventLoop::WRITABLE) { result |= EPOLLOUT; }
+            return result;
+        }
+
+        uint32_t from_epoll(uint32_t events) {
+            uint32_t result = 0;
+            if (events & EPOLLIN) { result |= EventLoop::READABLE; }
+            if (events & EPOLLOUT) { result |= EventLoop::WRITABLE; }
+            if (events & (EPOLLERR | EPOLLHUP)) { result |= EventLoop::FAILED; }
+            return result;
+        }
+#endif
+    }
+
+    EventLoop::EventLoop() {
+        pending_tasks_.reserve(16);
+        running_tasks_.reserve(16);
+#ifdef __linux__
+        epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+        wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (epoll_fd_ < 0 || wake_fd_ < 0 || timer_fd_ < 0) {
+            const std::string error = strerror(errno);
+            if (epoll_fd_ >= 0) { close(epoll_fd_); }
+            if (wake_fd_ >= 0) { close(wake_fd_); }
+            if (timer_fd_ >= 0) { close(timer_fd_); }
+            throw std::runtime_error("Olay döngüsü oluşturulamadı: " + error);
+        }
+        for (int fd : {wake_fd_, timer_fd_}) {
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.fd = fd;
+            epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event);
+        }
+#endif
+    }
+
+    EventLoop::~EventLoop() {
+        stop();
+#ifdef __linux__
+        close(timer_fd_);
+        close(wake_fd_);
+        close(epoll_fd_);
+#endif
+    }
+
+    void EventLoop::set_thread_tuning(const core::ThreadTuning& tuning, const char* thread_name) {
+        tuning_ = tuning;
+        thread_name_ = thread_name;
+    }
+
+    bool EventLoop::start() {
+        if (is_running()) { return true; }
+        if (thread_.joinable()) { thread_.join(); }
+        stop_requested_ = false;
+        is_running_.store(true, std::memory_order_release);
+        thread_ = std::thread(&EventLoop::run_loop, this);
+        return true;
+    }
+
+    void EventLoop::run() {
+        stop_requested_ = false;
+        is_running_.store(true, std::memory_order_release);
+        run_loop();
+    }
+
+    void EventLoop::stop() {
+        stop_requested_ = true;
+        wake();
+        if (thread_.joinable() && !in_loop_thread()) {
+            thread_.join();
+        }
+    }
+
+    bool EventLoop::in_loop_thread() const {
+        return loop_thread_id_.load(std::memory_order_relaxed) == std::this_thread::get_id();
+    }
+
+    void EventLoop::wake() {
+#ifdef __linux__
+        const uint64_t one = 1;
+        ssize_t written = write(wake_fd_, &one, sizeof(one));
+        (void)written;   // EAGAIN: sayaç zaten sıfırdan büyük, döngü uyanacak
+#else
+        std::lock_guard<std::mutex> lock(mutex_);
+        wake_cv_.notify_all();
+#endif
+    }
+
+    bool EventLoop::post(Task task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!is_running()) { return false; }
+            pending_tasks_.push_back(std::move(task));
+        }
+        wake();
+        return true;
+    }
+
+    void EventLoop::run_loop() {
+        loop_thread_id_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        if (tuning_.enabled() || core::is_memory_locked()) {
+            sched_policy_.store(core::apply_thread_tuning(tuning_, thread_name_), std::memory_order_relaxed);
+        }
+#ifdef __linux__
+        epoll_event events[MAX_EVENTS];
+        while (!stop_requested_) {
+            int count = epoll_wait(epoll_fd_, events, MAX_EVENTS, -1);
+            wakeups_.fetch_add(1, std::memory_order_relaxed);
+            if (count < 0) {
+                if (errno == EINTR) { continue; }
+                std::cerr << "HATA: epoll_wait - " << strerror(errno) << std::endl;
+                break;
+            }
+            for (int i = 0; i < count; ++i) {
+                const int fd = events[i].data.fd;
+                if (fd == wake_fd_ || fd == timer_fd_) {
+                    // Sayaçları boşalt; zamanlayıcılar ve işler aşağıda her turda kontrol edilir
+                    uint64_t value = 0;
+                    ssize_t bytes = read(fd, &value, sizeof(value));
+                    (void)bytes;
+                    continue;
+                }
+                dispatch_io(fd, from_epoll(events[i].events));
+            }
+            run_timers();
+            run_tasks();
+        }
+#else
+        while (!stop_requested_) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (pending_tasks_.empty() && !stop_requested_) {
+                    const auto deadline = timer_queue_.empty() ? Clock::now() + std::chrono::seconds(1)
+                                                               : timer_queue_.top().deadline;
+                    wake_cv_.wait_until(lock, deadline);
+                }
+            }
+            wakeups_.fetch_add(1, std::memory_order_relaxed);
+            run_timers();
+            run_tasks();
+        }
+#endif
+        // Durduktan sonra kabul edilmiş işler yine de çalışır (remove_fd bekleyenler takılmasın)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            is_running_.store(false, std::memory_order_release);
+        }
+        run_tasks();
+        loop_thread_id_.store(std::thread::id{}, std::memory_order_relaxed);
+    }
+
+    void EventLoop::run_tasks() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pending_tasks_.empty()) { return; }
+            running_tasks_.swap(pending_tasks_);
+        }
+        for (auto& task : running_tasks_) {
+            task();
+        }
+        tasks_run_.fetch_add(running_tasks_.size(), std::memory_order_relaxed);
+        running_tasks_.clear();
+    }
+
+    void EventLoop::dispatch_io(int fd, uint32_t events) {
+        std::shared_ptr<IoHandler> handler;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = handlers_.find(fd);
+            if (it == handlers_.end()) { return; }   // Aynı turda kaldırılmış
+            handler = it->second;
+        }
+        io_events_.fetch_add(1, std::memory_order_relaxed);
+        (*handler)(events);
+    }
+
+    bool EventLoop::add_fd(int fd, uint32_t events, IoHandler handler) {
+#ifdef __linux__
+        std::lock_guard<std::mutex> lock(mutex_);
+        epoll_event event{};
+        event.events = to_epoll(events);
+        event.data.fd = fd;
+        if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0) {
+            std::cerr << "HATA: epoll_ctl(ADD) - " << strerror(errno) << std::endl;
+            return false;
+        }
+        handlers_[fd] = std::make_shared<IoHandler>(std::move(handler));
+        return true;
+#else
+        (void)fd; (void)events; (void)handler;
+        return false;
+#endif
+    }
+
+    bool EventLoop::modify_fd(int fd, uint32_t events) {
+#ifdef __linux__
+        epoll_event event{};
+        event.events = to_epoll(events);
+        event.data.fd = fd;
+        return epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, fd, &event) == 0;
+#else
+        (void)fd; (void)events;
+        return false;
+#endif
+    }
+
+    void EventLoop::remove_fd(int fd) {
+        if (!in_loop_thread()) {
+            // Handler o anda çalışıyor olabilir: kaldırmayı döngü thread'inde yap ve bekle
+            auto done = std::make_shared<std::promise<void>>();
+            auto finished = done->get_future();
+            if (post([this, fd, done] { remove_fd_now(fd); done->set_value(); })) {
+                finished.wait();
+                return;
+            }
+        }
+        remove_fd_now(fd);
+    }
+
+    void EventLoop::remove_fd_now(int fd) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (handlers_.erase(fd) == 0) { return; }
+#ifdef __linux__
+        epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+#endif
+    }
+
+    EventLoop::TimerId EventLoop::add_timer(Clock::duration delay, Task callback, Clock::duration period) {
+        TimerId id;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            id = next_timer_id_++;
+            auto timer = std::make_shared<Timer>();
+            timer->deadline = Clock::now() + delay;
+            timer->period = period;
+            timer->callback = std::move(callback);
+            timer_queue_.push(TimerEntry{timer->deadline, id});
+            timers_.emplace(id, std::move(timer));
+            arm_timer_locked();
+        }
+#ifndef __linux__
+        wake();
+#endif
+        return id;
+    }
+
+    void EventLoop::cancel_timer(TimerId id) {
+        // Kuyruktaki kaydı kalır; yeniden kurma sırasında sahipsiz olduğu görülüp atlanır
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (timers_.erase(id) == 0) { return; }
+            arm_timer_locked();   // En yakın zamanlayıcı iptal edildiyse timerfd sonrakine çekilir
+        }
+#ifndef __linux__
+        wake();
+#endif
+    }
+
+    void EventLoop::run_timers() {
+        auto now = Clock::now();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!timer_queue_.empty() && timer_queue_.top().deadline <= now) {
+                wakeup_lateness_.record(now - timer_queue_.top().deadline);
+            }
+            while (!timer_queue_.empty() && timer_queue_.top().deadline <= now) {
+                const TimerEntry entry = timer_queue_.top();
+                timer_queue_.pop();
+                auto it = timers_.find(entry.id);
+                if (it != timers_.end() && it->second->deadline == entry.deadline) {
+                    due_timers_.emplace_back(entry.id, it->second);
+                }
+            }
+            if (due_timers_.empty()) {
+                // Yalnızca iptal edilmiş/eski kayıtlar dolmuş: timerfd bir sonraki gerçek zamanlayıcıya kurulur
+                arm_timer_locked();
+                return;
+            }
+        }
+
+        for (auto& due : due_timers_) {
+            due.second->callback();
+        }
+        timers_fired_.fetch_add(due_timers_.size(), std::memory_order_relaxed);
+
+        now = Clock::now();
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& due : due_timers_) {
+            auto it = timers_.find(due.first);
+            if (it == timers_.end() || it->second != due.second) { continue; }   // Callback içinde iptal
+            Timer& timer = *due.second;
+            if (timer.period <= Clock::duration::zero()) {
+                timers_.erase(it);
+                continue;
+            }
+            timer.deadline += timer.period;
+            if (timer.deadline <= now) {
+                timer.deadline += ((now - timer.deadline) / timer.period + 1) * timer.period;
+            }
+            timer_queue_.push(TimerEntry{timer.deadline, due.first});
+        }
+        due_timers_.clear();
+        arm_timer_locked();
+    }
+
+    void EventLoop::arm_timer_locked() {
+        // İptal edilmiş ya da yeniden kurulmuş zamanlayıcıların eski kayıtları boşuna uyandırmasın
+        while (!timer_queue_.empty()) {
+            auto it = timers_.find(timer_queue_.top().id);
+            if (it != timers_.end() && it->second->deadline == timer_queue_.top().deadline) { break; }
+            timer_queue_.pop();
+        }
+#ifdef __linux__
+        itimerspec spec{};
+        if (!timer_queue_.empty()) {
+            auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_queue_.top().deadline - Clock::now());
+            if (remaining.count() <= 0) {
+                remaining = std::chrono::nanoseconds(1);   // Sıfır zamanlayıcıyı kapatır
+            }
+            spec.it_value.tv_sec = static_cast<time_t>(remaining.count() / 1000000000);
+            spec.it_value.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+        }
+        timerfd_settime(timer_fd_, 0, &spec, nullptr);
+#endif
+    }
+
+    EventLoop::Stats EventLoop::get_stats() const {
+        Stats stats;
+        stats.wakeups = wakeups_.load(std::memory_order_relaxed);
+        stats.io_events = io_events_.load(std::memory_order_relaxed);
+        stats.timers_fired = timers_fired_.load(std::memory_order_relaxed);
+        stats.tasks_run = tasks_run_.load(std::memory_order_relaxed);
+        stats.sched_policy = sched_policy_.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats.fds = handlers_.size();
+        stats.timers = timers_.size();
+        return stats;
+    }
+}
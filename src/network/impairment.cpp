@@ -0,0 +1,196 @@
+#include "network/impairment.hpp"
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+namespace network {
+    namespace {
+        // Pareto şekil parametresi: ortalama sonlu, kuyruk ağır (netem benzeri gecikme sıçramaları)
+        constexpr double PARETO_SHAPE = 2.5;
+        // Tekrarlanan kopya, asıldan bu kadar sonra teslim edilir
+        constexpr auto DUPLICATE_SPACING = std::chrono::microseconds(500);
+
+        // Bozulma türü başına ayrı akış: (seed, akış numarası) çiftinden tohumlanır
+        enum Stream : uint32_t { LOSS_STREAM = 1, DELAY_STREAM, REORDER_STREAM, DUPLICATE_STREAM };
+
+        std::mt19937_64 make_stream(uint64_t seed, Stream stream) {
+            std::seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32),
+                                   static_cast<uint32_t>(stream)};
+            return std::mt19937_64(sequence);
+        }
+    }
+
+    ImpairmentModel::ImpairmentModel(const ImpairmentConfig& config)
+        : config_(config),
+          loss_rng_(make_stream(config.seed, LOSS_STREAM)),
+          delay_rng_(make_stream(config.seed, DELAY_STREAM)),
+          reorder_rng_(make_stream(config.seed, REORDER_STREAM)),
+          duplicate_rng_(make_stream(config.seed, DUPLICATE_STREAM)) {}
+
+    bool ImpairmentModel::should_drop() {
+        switch (config_.loss_model) {
+            case ImpairmentConfig::LossModel::Bernoulli:
+                return uniform_(loss_rng_) < config_.loss_rate;
+            case ImpairmentConfig::LossModel::GilbertElliott: {
+                double transition = bad_state_ ? config_.bad_to_good : config_.good_to_bad;
+                if (uniform_(loss_rng_) < transition) {
+                    bad_state_ = !bad_state_;
+                }
+                double loss = bad_state_ ? config_.loss_in_bad : config_.loss_in_good;
+                return uniform_(loss_rng_) < loss;
+            }
+            case ImpairmentConfig::LossModel::None:
+                break;
+        }
+        return false;
+    }
+
+    ImpairmentModel::Clock::duration ImpairmentModel::sample_delay() {
+        double base = static_cast<double>(config_.base_delay.count());
+        double jitter = static_cast<double>(config_.jitter.count());
+        double delay_us = base;
+        switch (config_.jitter_distribution) {
+            case ImpairmentConfig::DelayDistribution::Uniform:
+                delay_us += (uniform_(delay_rng_) * 2.0 - 1.0) * jitter;
+                break;
+            case ImpairmentConfig::DelayDistribution::Normal:
+                delay_us += normal_(delay_rng_) * jitter;
+                break;
+            case ImpairmentConfig::DelayDistribution::Pareto: {
+                // 1 - U, (0, 1] aralığında: sıfıra bölme olmaz
+                double u = 1.0 - uniform_(delay_rng_);
+                delay_us += jitter * (std::pow(u, -1.0 / PARETO_SHAPE) - 1.0);
+                break;
+            }
+            case ImpairmentConfig::DelayDistribution::Constant:
+                break;
+        }
+        delay_us = std::max(0.0, delay_us);
+        return std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double, std::micro>(delay_us));
+    }
+
+    void ImpairmentModel::process(Clock::time_point sent, size_t bytes, std::vector<Clock::time_point>& deliveries) {
+        deliveries.clear();
+        stats_.sent++;
+
+        // Düşürülen paket için de tüm akışlardan çekilir: her bozulmanın n. kararı n. pakete ait
+        // kalır, bir parametre değişse de diğer bozulmaların dizisi kaymaz (karşılaştırmalı koşular).
+        bool drop = should_drop();
+        Clock::duration delay = sample_delay();
+        bool reorder = uniform_(reorder_rng_) < config_.reorder_rate;
+        bool duplicate = uniform_(duplicate_rng_) < config_.duplicate_rate;
+
+        if (drop) {
+            stats_.lost++;
+            return;
+        }
+
+        Clock::time_point departure = sent;
+        if (config_.bandwidth_bps > 0) {
+            if (link_free_ < sent) {
+                link_free_ = sent;
+            }
+            double backlog_s = std::chrono::duration<double>(link_free_ - sent).count();
+            double backlog_bytes = backlog_s * static_cast<double>(config_.bandwidth_bps) / 8.0;
+            if (backlog_bytes + static_cast<double>(bytes) > static_cast<double>(config_.queue_limit_bytes)) {
+                stats_.queue_drops++;
+                return;
+            }
+            link_free_ += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(
+                static_cast<double>(bytes) * 8.0 / static_cast<double>(config_.bandwidth_bps)));
+            departure = link_free_;
+        }
+
+        Clock::time_point delivery = departure + delay;
+        if (reorder) {
+            delivery += config_.reorder_delay;
+            stats_.reordered++;
+        }
+        deliveries.push_back(delivery);
+        if (duplicate) {
+            deliveries.push_back(delivery + DUPLICATE_SPACING);
+            stats_.duplicated++;
+        }
+        stats_.delivered += deliveries.size();
+    }
+
+    ImpairmentProxy::ImpairmentProxy(const ImpairmentConfig& config) : model_(config) {}
+
+    ImpairmentProxy::~ImpairmentProxy() {
+        stop();
+    }
+
+    bool ImpairmentProxy::start(int listen_port, const std::string& target_ip, int target_port) {
+        if (is_running_) {
+            return true;
+        }
+        if (!sender_.connect(target_ip, target_port)) {
+            return false;
+        }
+        is_running_ = true;
+        forward_thread_ = std::thread(&ImpairmentProxy::forward_loop, this);
+        bool started = receiver_.start_raw(listen_port, [this](const uint8_t* data, size_t size, const sockaddr_in&) {
+            on_datagram(data, size);
+        });
+        if (!started) {
+            stop();
+            return false;
+        }
+        std::cout << "Bozulma proxy'si başlatıldı: " << listen_port << " -> "
+                  << target_ip << ":" << target_port << std::endl;
+        return true;
+    }
+
+    void ImpairmentProxy::stop() {
+        receiver_.stop();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!is_running_) {
+                return;
+            }
+            is_running_ = false;
+        }
+        wakeup_.notify_all();
+        if (forward_thread_.joinable()) {
+            forward_thread_.join();
+        }
+    }
+
+    ImpairmentModel::Stats ImpairmentProxy::get_stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return model_.get_stats();
+    }
+
+    void ImpairmentProxy::on_datagram(const uint8_t* data, size_t size) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            model_.process(ImpairmentModel::Clock::now(), size, deliveries_);
+            for (auto due : deliveries_) {
+                queue_.push(Scheduled{due, next_order_++, std::vector<uint8_t>(data, data + size)});
+            }
+        }
+        wakeup_.notify_one();
+    }
+
+    void ImpairmentProxy::forward_loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (is_running_) {
+            if (queue_.empty()) {
+                wakeup_.wait(lock);
+                continue;
+            }
+            auto due = queue_.top().due;
+            if (ImpairmentModel::Clock::now() < due) {
+                wakeup_.wait_until(lock, due);
+                continue;
+            }
+            // priority_queue::top const döner; taşımak için kopyalamadan önce çıkarılır
+            std::vector<uint8_t> data = std::move(const_cast<Scheduled&>(queue_.top()).data);
+            queue_.pop();
+            lock.unlock();
+            sender_.send_datagram(data.data(), data.size());
+            lock.lock();
+        }
+    }
+}
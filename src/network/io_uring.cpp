@@ -0,0 +1,222 @@
+#include "network/io_uring.hpp"
+#include <cstring>
+
+#ifdef VOICE_ENGINE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+#include <vector>
+#include <algorithm>
+#endif
+
+namespace network {
+    const char* io_backend_name(IoBackend backend) {
+        switch (backend) {
+            case IoBackend::Auto:    return "auto";
+            case IoBackend::Socket:  return "socket";
+            case IoBackend::IoUring: return "io_uring";
+        }
+        return "?";
+    }
+
+    bool parse_io_backend(const char* name, IoBackend& backend) {
+        const IoBackend candidates[] = {IoBackend::Auto, IoBackend::Socket, IoBackend::IoUring};
+        for (IoBackend candidate : candidates) {
+            if (std::strcmp(name, io_backend_name(candidate)) == 0) {
+                backend = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+#ifdef VOICE_ENGINE_IO_URING
+    namespace {
+        int sys_io_uring_setup(unsigned entries, io_uring_params* params) {
+            return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+            return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+        }
+
+        int sys_io_uring_register(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+            return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+        }
+
+        void* map_anonymous(size_t size) {
+            void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            return memory == MAP_FAILED ? nullptr : memory;
+        }
+
+        bool probe_kernel() {
+            IoUring ring;
+            if (!ring.init(4)) { return false; }
+
+            // Kullanılan işlemler: RECVMSG (provided buffer + multishot) ve SENDMSG
+            const size_t probe_size = sizeof(io_uring_probe) + IORING_OP_LAST * sizeof(io_uring_probe_op);
+            std::vector<uint8_t> storage(probe_size, 0);
+            auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+            if (sys_io_uring_register(ring.fd(), IORING_REGISTER_PROBE, probe, IORING_OP_LAST) < 0) {
+                return false;
+            }
+            for (int op : {IORING_OP_RECVMSG, IORING_OP_SENDMSG}) {
+                if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+                    return false;
+                }
+            }
+            // Provided-buffer ring (5.19+); multishot RECVMSG (6.0+) ilk tamamlanmada doğrulanır
+            return ring.setup_buffer_ring(0, 2, 64);
+        }
+    }
+
+    bool IoUring::is_supported() {
+        static const bool supported = probe_kernel();
+        return supported;
+    }
+
+    IoUring::~IoUring() {
+        if (ring_fd_ >= 0) { close(ring_fd_); }
+        if (buffers_) { munmap(buffers_, buffers_size_); }
+        if (buffer_ring_) { munmap(buffer_ring_, buffer_ring_size_); }
+        if (sqes_) { munmap(sqes_, sqes_size_); }
+        if (cq_ring_ && cq_ring_ != sq_ring_) { munmap(cq_ring_, cq_ring_size_); }
+        if (sq_ring_) { munmap(sq_ring_, sq_ring_size_); }
+    }
+
+    bool IoUring::init(unsigned entries, unsigned cq_entries) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        if (cq_entries > 0) {
+            params.flags |= IORING_SETUP_CQSIZE;
+            params.cq_entries = cq_entries;
+        }
+        ring_fd_ = sys_io_uring_setup(entries, &params);
+        if (ring_fd_ < 0) {
+            ring_fd_ = -1;
+            return false;
+        }
+
+        sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap) {
+            sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+        }
+        sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+        if (sq_ring_ == MAP_FAILED) { sq_ring_ = nullptr; return false; }
+        if (single_mmap) {
+            cq_ring_ = sq_ring_;
+        } else {
+            cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+            if (cq_ring_ == MAP_FAILED) { cq_ring_ = nullptr; return false; }
+        }
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) { return false; }
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        auto* sq = static_cast<uint8_t*>(sq_ring_);
+        auto* cq = static_cast<uint8_t*>(cq_ring_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_flags_ = reinterpret_cast<unsigned*>(sq + params.sq_off.flags);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        sq_entries_ = params.sq_entries;
+
+        // SQ dizisi birim eşleme: i. slot i. SQE'yi gösterir, gönderimde yeniden yazılmaz
+        auto* array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        for (unsigned i = 0; i < sq_entries_; ++i) { array[i] = i; }
+        sqe_tail_ = submitted_tail_ = *sq_tail_;
+        return true;
+    }
+
+    io_uring_sqe* IoUring::get_sqe() {
+        const unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        if (sqe_tail_ - head >= sq_entries_) {
+            return nullptr;
+        }
+        io_uring_sqe* sqe = &sqes_[sqe_tail_ & sq_mask_];
+        std::memset(sqe, 0, sizeof(*sqe));
+        ++sqe_tail_;
+        return sqe;
+    }
+
+    int IoUring::submit() {
+        const unsigned to_submit = sqe_tail_ - submitted_tail_;
+        if (to_submit == 0) { return 0; }
+        __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+        const int submitted = sys_io_uring_enter(ring_fd_, to_submit, 0, 0);
+        if (submitted < 0) {
+            return -errno;
+        }
+        submitted_tail_ += static_cast<unsigned>(submitted);
+        return submitted;
+    }
+
+    io_uring_cqe* IoUring::peek_cqe() {
+        const unsigned head = *cq_head_;
+        if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+            return nullptr;
+        }
+        return &cqes_[head & cq_mask_];
+    }
+
+    void IoUring::cqe_seen() {
+        __atomic_store_n(cq_head_, *cq_head_ + 1, __ATOMIC_RELEASE);
+    }
+
+    bool IoUring::flush_overflow() {
+        if (!(__atomic_load_n(sq_flags_, __ATOMIC_ACQUIRE) & IORING_SQ_CQ_OVERFLOW)) {
+            return false;
+        }
+        return sys_io_uring_enter(ring_fd_, 0, 0, IORING_ENTER_GETEVENTS) >= 0;
+    }
+
+    bool IoUring::setup_buffer_ring(uint16_t group, unsigned count, size_t buffer_size) {
+        if (count == 0 || (count & (count - 1)) != 0 || count > 32768) { return false; }
+        buffer_ring_size_ = count * sizeof(io_uring_buf);
+        buffer_ring_ = static_cast<io_uring_buf_ring*>(map_anonymous(buffer_ring_size_));
+        buffers_size_ = count * buffer_size;
+        buffers_ = static_cast<uint8_t*>(map_anonymous(buffers_size_));
+        if (!buffer_ring_ || !buffers_) { return false; }
+
+        io_uring_buf_reg registration;
+        std::memset(&registration, 0, sizeof(registration));
+        registration.ring_addr = reinterpret_cast<uint64_t>(buffer_ring_);
+        registration.ring_entries = count;
+        registration.bgid = group;
+        if (sys_io_uring_register(ring_fd_, IORING_REGISTER_PBUF_RING, &registration, 1) < 0) {
+            return false;
+        }
+        buffer_group_ = group;
+        buffer_size_ = buffer_size;
+        buffer_mask_ = count - 1;
+        buffer_tail_ = 0;
+        for (unsigned id = 0; id < count; ++id) {
+            recycle_buffer(static_cast<uint16_t>(id));
+        }
+        publish_buffers();
+        return true;
+    }
+
+    void IoUring::recycle_buffer(uint16_t id) {
+        // bufs[] C++'ta __DECLARE_FLEX_ARRAY yüzünden kayık derlenir; girdiler halkanın başından dizilir
+        io_uring_buf& entry = reinterpret_cast<io_uring_buf*>(buffer_ring_)[buffer_tail_ & buffer_mask_];
+        entry.addr = reinterpret_cast<uint64_t>(buffer(id));
+        entry.len = static_cast<uint32_t>(buffer_size_);
+        entry.bid = id;
+        ++buffer_tail_;
+    }
+
+    void IoUring::publish_buffers() {
+        __atomic_store_n(&buffer_ring_->tail, buffer_tail_, __ATOMIC_RELEASE);
+    }
+#endif
+}
@@ -0,0 +1,149 @@
+#include "network/stats_endpoint.hpp"
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+namespace network {
+    namespace {
+        // stop() bu süre içinde fark edilir
+        constexpr int POLL_TIMEOUT_MS = 100;
+    }
+
+    StatsEndpoint::StatsEndpoint(const Config& config) : config_(config) {}
+
+    StatsEndpoint::~StatsEndpoint() {
+        stop();
+    }
+
+    bool StatsEndpoint::start(SnapshotProvider provider) {
+        if (is_running_) { return true; }
+        provider_ = std::move(provider);
+        if (!config_.socket_path.empty() && !open_socket()) {
+            return false;
+        }
+        is_running_ = true;
+        thread_ = std::thread(&StatsEndpoint::serve_loop, this);
+        if (!config_.socket_path.empty()) {
+            std::cout << "İstatistik soketi: " << config_.socket_path << std::endl;
+        }
+        if (!config_.json_path.empty()) {
+            std::cout << "İstatistik dökümü: " << config_.json_path
+                      << " (" << config_.dump_interval.count() << " ms)" << std::endl;
+        }
+        return true;
+    }
+
+    void StatsEndpoint::stop() {
+        if (!is_running_.exchange(false)) { return; }
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        // Son durum kapanışta da dosyaya yazılır
+        write_dump();
+#ifndef _WIN32
+        if (listen_socket_ >= 0) {
+            close(listen_socket_);
+            listen_socket_ = -1;
+            unlink(config_.socket_path.c_str());
+        }
+#endif
+    }
+
+    bool StatsEndpoint::open_socket() {
+#ifdef _WIN32
+        std::cerr << "UYARI: UNIX domain soketi bu platformda desteklenmiyor; yalnızca dosya dökümü." << std::endl;
+        return true;
+#else
+        sockaddr_un address{};
+        if (config_.socket_path.size() >= sizeof(address.sun_path)) {
+            std::cerr << "HATA: İstatistik soket yolu çok uzun: " << config_.socket_path << std::endl;
+            return false;
+        }
+        listen_socket_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listen_socket_ < 0) {
+            std::cerr << "HATA: İstatistik soketi oluşturulamadı: " << strerror(errno) << std::endl;
+            return false;
+        }
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, config_.socket_path.c_str(), config_.socket_path.size() + 1);
+        // Önceki çalışmadan kalmış soket dosyası bind'i engeller
+        unlink(config_.socket_path.c_str());
+        if (bind(listen_socket_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0 ||
+            listen(listen_socket_, 4) < 0) {
+            std::cerr << "HATA: İstatistik soketi dinlenemiyor: " << strerror(errno) << std::endl;
+            close(listen_socket_);
+            listen_socket_ = -1;
+            return false;
+        }
+        return true;
+#endif
+    }
+
+    void StatsEndpoint::serve_loop() {
+        auto next_dump = std::chrono::steady_clock::now() + config_.dump_interval;
+        while (is_running_) {
+            int timeout_ms = POLL_TIMEOUT_MS;
+            if (!config_.json_path.empty()) {
+                auto until_dump = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    next_dump - std::chrono::steady_clock::now()).count();
+                timeout_ms = static_cast<int>(std::max<int64_t>(0, std::min<int64_t>(timeout_ms, until_dump)));
+            }
+#ifndef _WIN32
+            if (listen_socket_ >= 0) {
+                pollfd descriptor{listen_socket_, POLLIN, 0};
+                if (poll(&descriptor, 1, timeout_ms) > 0 && (descriptor.revents & POLLIN)) {
+                    serve_client();
+                }
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+            }
+#else
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+#endif
+            if (!config_.json_path.empty() && std::chrono::steady_clock::now() >= next_dump) {
+                write_dump();
+                next_dump += config_.dump_interval;
+            }
+        }
+    }
+
+    void StatsEndpoint::serve_client() {
+#ifndef _WIN32
+        int client = accept4(listen_socket_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client < 0) { return; }
+        std::string payload = provider_();
+        payload.push_back('\n');
+        const char* data = payload.data();
+        size_t remaining = payload.size();
+        while (remaining > 0) {
+            ssize_t written = send(client, data, remaining, MSG_NOSIGNAL);
+            if (written < 0 && errno == EINTR) { continue; }
+            if (written <= 0) { break; }
+            data += written;
+            remaining -= static_cast<size_t>(written);
+        }
+        close(client);
+#endif
+    }
+
+    void StatsEndpoint::write_dump() {
+        if (config_.json_path.empty() || !provider_) { return; }
+        const std::string temp_path = config_.json_path + ".tmp";
+        {
+            std::ofstream file(temp_path, std::ios::trunc);
+            if (!file) { return; }
+            file << provider_() << "\n";
+        }
+        std::rename(temp_path.c_str(), config_.json_path.c_str());
+    }
+}
@@ -3,8 +3,23 @@
 #include <stdexcept>
 #include <vector>
 
+#ifdef VOICE_ENGINE_IO_URING
+#include <linux/io_uring.h>
+#endif
+#ifdef __linux__
+#include <fcntl.h>
+#include <errno.h>
+#include <cstring>
+#include <algorithm>
+#endif
+
+namespace {
+    constexpr uint16_t URING_BUFFER_GROUP = 0;
+    constexpr uint64_t URING_RECEIVE_TAG = 1;
+}
+
 namespace network {
-UdpReceiver::UdpReceiver() {
+UdpReceiver::UdpReceiver(EventLoop* loop) : loop_(loop) {
 #ifdef _WIN32
     if (WSAStartup(MAKEWORD(2, 2), &wsa_data_) != 0) { throw std::runtime_error("WSAStartup basarisiz oldu."); }
 #endif
@@ -20,6 +35,18 @@ UdpReceiver::~UdpReceiver() {
 bool UdpReceiver::start(int port, OnPacketReceived callback) {
     if (is_running_) { return true; }
     on_packet_received_ = std::move(callback);
+    on_datagram_received_ = nullptr;
+    return open_socket(port);
+}
+
+bool UdpReceiver::start_raw(int port, OnDatagramReceived callback) {
+    if (is_running_) { return true; }
+    on_datagram_received_ = std::move(callback);
+    on_packet_received_ = nullptr;
+    return open_socket(port);
+}
+
+bool UdpReceiver::open_socket(int port) {
     socket_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
 #ifdef _WIN32
     if (socket_ == INVALID_SOCKET) {
@@ -37,7 +64,15 @@ bool UdpReceiver::start(int port, OnPacketReceived callback) {
         std::cerr << "UYARI: Receive buffer size ayarlanamadi." << std::endl;
     }
     
-    // Socket timeout ayarları
+#endif
+#ifdef __linux__
+    // Hazır olma olayıyla okunur; soket bloklamaz, olay yokken thread uyanmaz
+    int flags = fcntl(socket_, F_GETFL, 0);
+    if (flags >= 0) {
+        fcntl(socket_, F_SETFL, flags | O_NONBLOCK);
+    }
+#elif !defined(_WIN32)
+    // Alım thread'i durdurma isteğini kontrol edebilsin diye periyodik uyanır
     struct timeval timeout;
     timeout.tv_sec = 0;
     timeout.tv_usec = 100000; // 100ms timeout
@@ -54,14 +89,56 @@ bool UdpReceiver::start(int port, OnPacketReceived callback) {
         std::cerr << "HATA: Socket " << port << " portuna bind edilemedi." << std::endl;
         return false;
     }
+    slot_storage_.resize((batching_enabled_ ? BATCH_SIZE : 1) * MAX_DATAGRAM_SIZE);
     is_running_ = true;
+#ifdef __linux__
+    if (!loop_) {
+        own_loop_ = std::make_unique<EventLoop>();
+        own_loop_->set_thread_tuning(tuning_, "udp-receiver");
+        loop_ = own_loop_.get();
+        loop_->start();
+    }
+#ifdef VOICE_ENGINE_IO_URING
+    if (requested_backend_ != IoBackend::Socket && start_uring()) {
+        std::cout << "Receiver " << port << " portunu dinlemeye basladi (io_uring)." << std::endl;
+        return true;
+    }
+    if (requested_backend_ == IoBackend::IoUring) {
+        std::cerr << "UYARI: io_uring kullanılamıyor, soket çağrılarına dönülüyor." << std::endl;
+    }
+#endif
+    active_backend_ = IoBackend::Socket;
+    if (!loop_->add_fd(socket_, EventLoop::READABLE, [this](uint32_t) { on_readable(); })) {
+        std::cerr << "HATA: Socket olay döngüsüne eklenemedi." << std::endl;
+        stop();
+        return false;
+    }
+#else
     receiver_thread_ = std::thread(&UdpReceiver::receive_loop, this);
+#endif
     std::cout << "Receiver " << port << " portunu dinlemeye basladi (Optimized)." << std::endl;
     return true;
 }
 
 void UdpReceiver::stop() {
     is_running_ = false;
+#ifdef __linux__
+    if (loop_ && socket_ != -1) {
+        // Döndüğünde handler çalışmıyor; soket güvenle kapatılabilir
+#ifdef VOICE_ENGINE_IO_URING
+        if (uring_) {
+            loop_->remove_fd(uring_->fd());
+            uring_.reset();   // Halkanın kapanması bekleyen multishot alımı iptal eder
+        }
+#endif
+        loop_->remove_fd(socket_);
+    }
+    if (own_loop_) {
+        own_loop_->stop();
+        own_loop_.reset();
+        loop_ = nullptr;
+    }
+#endif
     if (socket_ != -1) {
 #ifdef _WIN32
         closesocket(socket_);
@@ -77,19 +154,187 @@ void UdpReceiver::stop() {
     }
 }
 
-void UdpReceiver::receive_loop() {
-    std::vector<uint8_t> buffer(2048);
+UdpReceiver::ReceiverStats UdpReceiver::get_stats() const {
+    ReceiverStats stats;
+    stats.datagrams = datagram_count_.load(std::memory_order_relaxed);
+    stats.syscalls = syscall_count_.load(std::memory_order_relaxed);
+    stats.errors = error_count_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void UdpReceiver::dispatch(const uint8_t* data, size_t size, const sockaddr_in& source) {
+    datagram_count_.fetch_add(1, std::memory_order_relaxed);
+    if (on_datagram_received_) {
+        on_datagram_received_(data, size, source);
+    } else if (on_packet_received_) {
+        on_packet_received_(core::Packet::from_bytes(data, size));
+    }
+}
+
+bool UdpReceiver::receive_single() {
+    uint8_t* buffer = slot_storage_.data();
     sockaddr_in client_address{};
     socklen_t client_len = sizeof(client_address);
-    while (is_running_) {
-        int bytes_received = recvfrom(socket_, reinterpret_cast<char*>(buffer.data()), buffer.size(), 0, (sockaddr*)&client_address, &client_len);
-        if (bytes_received > 0) {
-            std::vector<uint8_t> received_data(buffer.begin(), buffer.begin() + bytes_received);
-            if (on_packet_received_) {
-                on_packet_received_(core::Packet::from_bytes(received_data));
+    int bytes_received = recvfrom(socket_, reinterpret_cast<char*>(buffer), MAX_DATAGRAM_SIZE, 0, (sockaddr*)&client_address, &client_len);
+    syscall_count_.fetch_add(1, std::memory_order_relaxed);
+    if (bytes_received < 0) {
+        return false;
+    }
+    if (bytes_received > 0) {
+        dispatch(buffer, static_cast<size_t>(bytes_received), client_address);
+    }
+    return true;
+}
+
+#ifdef VOICE_ENGINE_IO_URING
+bool UdpReceiver::start_uring() {
+    if (!IoUring::is_supported()) { return false; }
+    auto ring = std::make_unique<IoUring>();
+    if (!ring->init(16, URING_COMPLETION_ENTRIES) || !ring->setup_buffer_ring(URING_BUFFER_GROUP, URING_BUFFER_COUNT, URING_BUFFER_SIZE)) {
+        return false;
+    }
+    uring_ = std::move(ring);
+    uring_msg_ = msghdr{};
+    uring_msg_.msg_namelen = sizeof(sockaddr_in);
+    uring_received_ = false;
+    if (!loop_->add_fd(uring_->fd(), EventLoop::READABLE, [this](uint32_t) { on_uring_ready(); })) {
+        uring_.reset();
+        return false;
+    }
+    active_backend_ = IoBackend::IoUring;
+    // İstek döngü thread'inden verilir: tamamlanma işi (task_work) isteği veren thread'de
+    // çalışır ve o thread sonlanırsa istek iptal olur
+    if (!loop_->post([this] { arm_uring_receive(); })) {
+        arm_uring_receive();
+    }
+    return true;
+}
+
+void UdpReceiver::arm_uring_receive() {
+    io_uring_sqe* sqe = uring_ ? uring_->get_sqe() : nullptr;
+    if (!sqe) { return; }
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = socket_;
+    sqe->addr = reinterpret_cast<uint64_t>(&uring_msg_);
+    sqe->len = 1;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = URING_BUFFER_GROUP;
+    sqe->user_data = URING_RECEIVE_TAG;
+    uring_->submit();
+    syscall_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void UdpReceiver::on_uring_ready() {
+    bool rearm = false;
+    unsigned recycled = 0;
+    // CQ taşmışsa taşma listesindekiler halkaya alınıp işlenmeye devam edilir
+    do {
+        while (io_uring_cqe* cqe = uring_->peek_cqe()) {
+            const int result = cqe->res;
+            const uint32_t flags = cqe->flags;
+            uring_->cqe_seen();
+            if (!(flags & IORING_CQE_F_MORE)) {
+                rearm = true;   // Multishot sona erdi (tampon bitti vb.), yeniden kurulmalı
+            }
+            if (result < 0) {
+                if ((result == -EINVAL || result == -EOPNOTSUPP) && !uring_received_) {
+                    fallback_to_socket();
+                    return;
+                }
+                error_count_.fetch_add(1, std::memory_order_relaxed);
+                if (result == -ENOBUFS && rearm && is_running_) {
+                    // Tampon halkası tükendi, multishot bitti. Önceki tamamlanmaların tamponları geri
+                    // verildi: halka hemen yayınlanıp alım yeniden kurulur. Datagramlar soket kuyruğunda
+                    // bekler, kalan CQE'ler işlenene kadar beklenirse kuyruk taşabilir.
+                    uring_->publish_buffers();
+                    arm_uring_receive();
+                    rearm = false;
+                }
+                continue;
+            }
+            if (!(flags & IORING_CQE_F_BUFFER)) { continue; }
+
+            // Tampon düzeni: io_uring_recvmsg_out | kaynak adres (msg_namelen) | payload
+            const uint16_t id = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+            const uint8_t* buffer = uring_->buffer(id);
+            const auto* out = reinterpret_cast<const io_uring_recvmsg_out*>(buffer);
+            const size_t header = sizeof(io_uring_recvmsg_out) + uring_msg_.msg_namelen + uring_msg_.msg_controllen;
+            if (static_cast<size_t>(result) >= header) {
+                sockaddr_in source{};
+                std::memcpy(&source, buffer + sizeof(io_uring_recvmsg_out),
+                            std::min<size_t>(out->namelen, sizeof(source)));
+                const size_t size = std::min<size_t>(out->payloadlen, static_cast<size_t>(result) - header);
+                uring_received_ = true;
+                if (size > 0 && is_running_) {
+                    dispatch(buffer + header, size, source);
+                }
+            }
+            uring_->recycle_buffer(id);
+            if (++recycled % URING_PUBLISH_BATCH == 0) {
+                uring_->publish_buffers();
             }
         }
+    } while (uring_->flush_overflow());
+    uring_->publish_buffers();
+    if (rearm && is_running_) {
+        arm_uring_receive();
+    }
+}
+
+void UdpReceiver::fallback_to_socket() {
+    // Döngü thread'i: çekirdek multishot RECVMSG'yi desteklemiyor
+    std::cerr << "UYARI: Çekirdek multishot alımı desteklemiyor, soket çağrılarına dönüldü." << std::endl;
+    loop_->remove_fd(uring_->fd());
+    uring_.reset();
+    active_backend_ = IoBackend::Socket;
+    if (!loop_->add_fd(socket_, EventLoop::READABLE, [this](uint32_t) { on_readable(); })) {
+        std::cerr << "HATA: Socket olay döngüsüne eklenemedi." << std::endl;
+    }
+}
+#endif
+
+#ifdef __linux__
+void UdpReceiver::on_readable() {
+    for (size_t read = 0; read < MAX_READS_PER_EVENT && is_running_; ++read) {
+        const bool more = batching_enabled_ ? receive_batch() : receive_single();
+        if (!more) { break; }
+    }
+}
+
+bool UdpReceiver::receive_batch() {
+    // recvmmsg: tek syscall ile BATCH_SIZE datagram'a kadar, önceden ayrılmış slotlara
+    mmsghdr headers[BATCH_SIZE];
+    iovec iovecs[BATCH_SIZE];
+    sockaddr_in addresses[BATCH_SIZE];
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        iovecs[i].iov_base = slot_storage_.data() + i * MAX_DATAGRAM_SIZE;
+        iovecs[i].iov_len = MAX_DATAGRAM_SIZE;
+        headers[i] = mmsghdr{};
+        headers[i].msg_hdr.msg_iov = &iovecs[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+        headers[i].msg_hdr.msg_name = &addresses[i];
+        headers[i].msg_hdr.msg_namelen = sizeof(addresses[i]);
+    }
+    // Soket bloklamaz: yalnızca hazır olanlar toplanır
+    int count = recvmmsg(socket_, headers, BATCH_SIZE, MSG_DONTWAIT, nullptr);
+    syscall_count_.fetch_add(1, std::memory_order_relaxed);
+    for (int i = 0; i < count; ++i) {
+        if (headers[i].msg_len > 0) {
+            dispatch(static_cast<const uint8_t*>(iovecs[i].iov_base), headers[i].msg_len, addresses[i]);
+        }
+    }
+    return count == static_cast<int>(BATCH_SIZE);
+}
+#else
+void UdpReceiver::receive_loop() {
+    if (tuning_.enabled() || core::is_memory_locked()) {
+        core::apply_thread_tuning(tuning_, "udp-receiver");
+    }
+    while (is_running_) {
+        receive_single();
     }
     std::cout << "Receiver dongusu sonlandi." << std::endl;
 }
+#endif
 }
\ No newline at end of file
@@ -1,15 +1,43 @@
 #include "network/udp_sender.hpp"
 #include <iostream>
 #include <stdexcept>
+#include <cstring>
+#include <thread>
+#include <chrono>
+
+#ifdef VOICE_ENGINE_IO_URING
+#include <linux/io_uring.h>
+#endif
 
 namespace network {
-    UdpSender::UdpSender() {
+    UdpSender::UdpSender() : send_buffer_(BATCH_SIZE * MAX_DATAGRAM_SIZE) {
+        packet_views_.reserve(BATCH_SIZE);
 #ifdef _WIN32
         if (WSAStartup(MAKEWORD(2, 2), &wsa_data_) != 0) { throw std::runtime_error("WSAStartup basarisiz oldu."); }
+#endif
+#ifdef __linux__
+        batch_headers_.resize(BATCH_SIZE);
+        batch_iovecs_.resize(BATCH_SIZE);
 #endif
     }
 
     UdpSender::~UdpSender() {
+        if (loop_ && socket_ != -1) {
+            loop_->remove_fd(socket_);
+        }
+#ifdef VOICE_ENGINE_IO_URING
+        if (uring_) {
+            // Uçuştaki SENDMSG'ler slot tamponlarını gösterir: kısa bir süre tamamlanmalarını bekle
+            std::lock_guard<std::mutex> lock(send_mutex_);
+            for (int attempt = 0; attempt < 100 && free_uring_slots_.size() < URING_SEND_SLOTS; ++attempt) {
+                reap_uring_locked();
+                if (free_uring_slots_.size() < URING_SEND_SLOTS) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+            uring_.reset();
+        }
+#endif
         if (socket_ != -1) {
 #ifdef _WIN32
             closesocket(socket_);
@@ -20,7 +48,73 @@ namespace network {
         }
     }
 
+    namespace {
+        bool would_block() {
+#ifdef _WIN32
+            return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+        }
+    }
+
+    bool UdpSender::attach(EventLoop* loop) {
+        std::lock_guard<std::mutex> lock(send_mutex_);
+        if (!loop || loop_ || socket_ == -1) {
+            return loop_ == loop && loop != nullptr;
+        }
+        // Olay maskesi boş başlar; yalnızca kuyrukta bekleyen varken yazılabilirlik dinlenir
+        if (!loop->add_fd(socket_, 0, [this](uint32_t events) {
+                if (events & EventLoop::FAILED) {
+                    int error = 0;
+                    socklen_t length = sizeof(error);
+                    getsockopt(socket_, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &length);
+                }
+                flush_queue();
+            })) {
+            return false;
+        }
+        queue_storage_.resize(SEND_QUEUE_CAPACITY * MAX_DATAGRAM_SIZE);
+        queue_entries_.resize(SEND_QUEUE_CAPACITY);
+        loop_ = loop;
+        return true;
+    }
+
+    UdpSender::SenderStats UdpSender::get_stats() const {
+        SenderStats stats;
+        stats.datagrams_sent = sent_count_.load(std::memory_order_relaxed);
+        stats.queued = queued_count_.load(std::memory_order_relaxed);
+        stats.dropped = dropped_count_.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(send_mutex_);
+        stats.queue_depth = queue_size_;
+        return stats;
+    }
+
     bool UdpSender::connect(const std::string& ip_address, int port) {
+        if (!open()) {
+            return false;
+        }
+
+        server_address_.sin_family = AF_INET;
+        server_address_.sin_port = htons(port);
+        int ip_result = inet_pton(AF_INET, ip_address.c_str(), &server_address_.sin_addr);
+        if (ip_result <= 0) {
+            std::cerr << "HATA: Gecersiz IP adresi: " << ip_address << std::endl;
+            
+#ifdef _WIN32
+            closesocket(socket_);
+            socket_ = INVALID_SOCKET;
+#else
+            close(socket_);
+            socket_ = -1;
+#endif
+            return false;
+        }
+        std::cout << "Sender " << ip_address << ":" << port << " adresine baglanmaya hazir (Optimized)." << std::endl;
+        return true;
+    }
+
+    bool UdpSender::open() {
         socket_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
 #ifdef _WIN32
         if (socket_ == INVALID_SOCKET) {
@@ -44,46 +138,300 @@ namespace network {
             fcntl(socket_, F_SETFL, flags | O_NONBLOCK);
         }
 #endif
-
-        server_address_.sin_family = AF_INET;
-        server_address_.sin_port = htons(port);
-        int ip_result = inet_pton(AF_INET, ip_address.c_str(), &server_address_.sin_addr);
-        if (ip_result <= 0) {
-            std::cerr << "HATA: Gecersiz IP adresi: " << ip_address << std::endl;
-            
-#ifdef _WIN32
-            closesocket(socket_);
-            socket_ = INVALID_SOCKET;
-#else
-            close(socket_);
-            socket_ = -1;
+#ifdef VOICE_ENGINE_IO_URING
+        if (requested_backend_ != IoBackend::Socket && !start_uring() && requested_backend_ == IoBackend::IoUring) {
+            std::cerr << "UYARI: io_uring kullanılamıyor, soket çağrılarına dönülüyor." << std::endl;
+        }
 #endif
+        return true;
+    }
+
+#ifdef VOICE_ENGINE_IO_URING
+    bool UdpSender::start_uring() {
+        if (!IoUring::is_supported()) { return false; }
+        auto ring = std::make_unique<IoUring>();
+        if (!ring->init(URING_SEND_SLOTS)) { return false; }
+        uring_slots_.resize(URING_SEND_SLOTS);
+        uring_storage_.resize(URING_SEND_SLOTS * MAX_DATAGRAM_SIZE);
+        free_uring_slots_.clear();
+        for (size_t slot = URING_SEND_SLOTS; slot > 0; --slot) {
+            free_uring_slots_.push_back(slot - 1);
+        }
+        uring_ = std::move(ring);
+        return true;
+    }
+
+    uint8_t* UdpSender::acquire_uring_slot_locked(size_t& slot) {
+        if (free_uring_slots_.empty()) {
+            reap_uring_locked();
+            if (free_uring_slots_.empty()) { return nullptr; }
+        }
+        slot = free_uring_slots_.back();
+        free_uring_slots_.pop_back();
+        return uring_storage_.data() + slot * MAX_DATAGRAM_SIZE;
+    }
+
+    bool UdpSender::prepare_uring_locked(size_t slot, size_t size, const sockaddr_in& destination) {
+        io_uring_sqe* sqe = uring_->get_sqe();
+        if (!sqe) {
+            free_uring_slots_.push_back(slot);
             return false;
         }
-        std::cout << "Sender " << ip_address << ":" << port << " adresine baglanmaya hazir (Optimized)." << std::endl;
+        UringSlot& entry = uring_slots_[slot];
+        entry.destination = destination;
+        entry.vector.iov_base = uring_storage_.data() + slot * MAX_DATAGRAM_SIZE;
+        entry.vector.iov_len = size;
+        entry.message = msghdr{};
+        entry.message.msg_name = &entry.destination;
+        entry.message.msg_namelen = sizeof(entry.destination);
+        entry.message.msg_iov = &entry.vector;
+        entry.message.msg_iovlen = 1;
+
+        sqe->opcode = IORING_OP_SENDMSG;
+        sqe->fd = socket_;
+        sqe->addr = reinterpret_cast<uint64_t>(&entry.message);
+        sqe->len = 1;
+        sqe->user_data = slot;
         return true;
     }
 
-    void UdpSender::send(const core::Packet& packet) {
-        auto bytes = packet.to_bytes();
-        ssize_t result = sendto(socket_, reinterpret_cast<const char*>(bytes.data()), bytes.size(), 
-                               0, (const sockaddr*)&server_address_, sizeof(server_address_));
-        
-        if (result < 0) {
-#ifdef _WIN32
-            int error = WSAGetLastError();
-            if (error != WSAEWOULDBLOCK) {
-                std::cerr << "UDP Send hatası: " << error << std::endl;
+    void UdpSender::submit_uring_locked() {
+        if (uring_->pending() > 0) {
+            const int result = uring_->submit();
+            if (result < 0 && result != -EAGAIN && result != -EBUSY) {
+                // SQE'ler halkada kalır, bir sonraki submit'te yeniden denenir
+                errno = -result;
+                report_send_error();
             }
-#else
-            if (errno != EAGAIN && errno != EWOULDBLOCK) {
-                std::cerr << "UDP Send hatası: " << strerror(errno) << std::endl;
+        }
+        // Hazır tamamlanmalar her gönderimde toplanır (syscall'sız): sayaçlar ve hata raporları
+        // slotlar tükenene kadar gecikmez. UDP SENDMSG çoğunlukla submit içinde tamamlanır.
+        reap_uring_locked();
+    }
+
+    void UdpSender::reap_uring_locked() {
+        while (io_uring_cqe* cqe = uring_->peek_cqe()) {
+            const size_t slot = static_cast<size_t>(cqe->user_data);
+            const int result = cqe->res;
+            uring_->cqe_seen();
+            if (result < 0) {
+                dropped_count_.fetch_add(1, std::memory_order_relaxed);
+                errno = -result;
+                report_send_error();
+            } else {
+                sent_count_.fetch_add(1, std::memory_order_relaxed);
             }
+            if (slot < URING_SEND_SLOTS) {
+                free_uring_slots_.push_back(slot);
+            }
+        }
+    }
 #endif
+
+    void UdpSender::send(const core::Packet& packet) {
+        send(packet.view());
+    }
+
+    void UdpSender::send(const core::PacketView& packet) {
+        std::lock_guard<std::mutex> lock(send_mutex_);
+        size_t size = packet.serialize(send_buffer_.data(), MAX_DATAGRAM_SIZE);
+        if (size == 0) {
+            std::cerr << "UYARI: Paket datagram boyutunu aşıyor: " << packet.serialized_size() << std::endl;
+            return;
+        }
+        send_one_locked(send_buffer_.data(), size, server_address_);
+    }
+
+    void UdpSender::send_datagram(const uint8_t* data, size_t size) {
+        if (!data || size == 0 || size > MAX_DATAGRAM_SIZE) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(send_mutex_);
+        send_one_locked(data, size, server_address_);
+    }
+
+    void UdpSender::send_one_locked(const uint8_t* data, size_t size, const sockaddr_in& destination) {
+#ifdef VOICE_ENGINE_IO_URING
+        if (uring_) {
+            size_t slot;
+            if (uint8_t* buffer = acquire_uring_slot_locked(slot)) {
+                std::memcpy(buffer, data, size);
+                if (prepare_uring_locked(slot, size, destination)) {
+                    submit_uring_locked();
+                    return;
+                }
+            }
+            // Slot yok: önce verilmiş olanlar gitsin, bu datagram soket yolundan
+            submit_uring_locked();
         }
+#endif
+        if (queue_size_ > 0) {
+            // Sıra bozulmasın: önce bekleyenler gitmeli
+            enqueue_locked(data, size, destination);
+            return;
+        }
+        if (sendto(socket_, reinterpret_cast<const char*>(data), size, 0,
+                   (const sockaddr*)&destination, sizeof(destination)) < 0) {
+            if (would_block()) {
+                enqueue_locked(data, size, destination);
+            } else {
+                report_send_error();
+            }
+            return;
+        }
+        sent_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void UdpSender::enqueue_locked(const uint8_t* data, size_t size, const sockaddr_in& destination) {
+        if (!loop_ || queue_size_ == SEND_QUEUE_CAPACITY) {
+            dropped_count_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        const size_t slot = (queue_head_ + queue_size_) % SEND_QUEUE_CAPACITY;
+        std::memcpy(queue_storage_.data() + slot * MAX_DATAGRAM_SIZE, data, size);
+        queue_entries_[slot] = QueuedDatagram{destination, size};
+        ++queue_size_;
+        queued_count_.fetch_add(1, std::memory_order_relaxed);
+        set_write_interest_locked(true);
+    }
+
+    void UdpSender::flush_queue() {
+        // Döngü thread'i: soket yazılabilir
+        std::lock_guard<std::mutex> lock(send_mutex_);
+        while (queue_size_ > 0) {
+            const QueuedDatagram& entry = queue_entries_[queue_head_];
+            if (sendto(socket_, reinterpret_cast<const char*>(queue_storage_.data() + queue_head_ * MAX_DATAGRAM_SIZE),
+                       entry.size, 0, (const sockaddr*)&entry.destination, sizeof(entry.destination)) < 0) {
+                if (would_block()) {
+                    break;
+                }
+                report_send_error();
+                dropped_count_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                sent_count_.fetch_add(1, std::memory_order_relaxed);
+            }
+            queue_head_ = (queue_head_ + 1) % SEND_QUEUE_CAPACITY;
+            --queue_size_;
+        }
+        if (queue_size_ == 0) {
+            set_write_interest_locked(false);
+        }
+    }
+
+    void UdpSender::set_write_interest_locked(bool enabled) {
+        if (!loop_ || write_interest_ == enabled) {
+            return;
+        }
+        loop_->modify_fd(socket_, enabled ? EventLoop::WRITABLE : 0);
+        write_interest_ = enabled;
     }
 
     void UdpSender::send(const std::vector<core::Packet>& packets) {
-        for (const auto& packet : packets) { send(packet); }
+        packet_views_.clear();
+        for (const auto& packet : packets) { packet_views_.push_back(packet.view()); }
+        send(packet_views_);
+    }
+
+    void UdpSender::send(const std::vector<core::PacketView>& packets) {
+        send_batch(packets, nullptr);
+    }
+
+    void UdpSender::send_to(const std::vector<core::PacketView>& packets, const std::vector<sockaddr_in>& destinations) {
+        if (destinations.size() < packets.size()) {
+            std::cerr << "UYARI: send_to için hedef sayısı paket sayısından az." << std::endl;
+            return;
+        }
+        send_batch(packets, destinations.data());
+    }
+
+    void UdpSender::send_batch(const std::vector<core::PacketView>& packets, const sockaddr_in* destinations) {
+        std::lock_guard<std::mutex> lock(send_mutex_);
+#ifdef VOICE_ENGINE_IO_URING
+        if (uring_) {
+            // Batch'in tamamı tek io_uring_enter ile; slot tükenirse kalanlar tek tek soket yolundan
+            for (size_t i = 0; i < packets.size(); ++i) {
+                const sockaddr_in& destination = destinations ? destinations[i] : server_address_;
+                size_t slot;
+                uint8_t* buffer = acquire_uring_slot_locked(slot);
+                if (buffer) {
+                    const size_t size = packets[i].serialize(buffer, MAX_DATAGRAM_SIZE);
+                    if (size == 0) {
+                        free_uring_slots_.push_back(slot);
+                        std::cerr << "UYARI: Paket datagram boyutunu aşıyor." << std::endl;
+                        continue;
+                    }
+                    if (prepare_uring_locked(slot, size, destination)) { continue; }
+                }
+                const size_t size = packets[i].serialize(send_buffer_.data(), MAX_DATAGRAM_SIZE);
+                if (size > 0) {
+                    send_one_locked(send_buffer_.data(), size, destination);
+                }
+            }
+            submit_uring_locked();
+            return;
+        }
+#endif
+#ifdef __linux__
+        size_t index = 0;
+        while (index < packets.size()) {
+            // Bir batch'i önceden ayrılmış slotlara serialize et
+            unsigned int batch_count = 0;
+            while (index < packets.size() && batch_count < BATCH_SIZE) {
+                uint8_t* slot = send_buffer_.data() + batch_count * MAX_DATAGRAM_SIZE;
+                size_t size = packets[index].serialize(slot, MAX_DATAGRAM_SIZE);
+                const sockaddr_in* destination = destinations ? &destinations[index] : &server_address_;
+                ++index;
+                if (size == 0) {
+                    std::cerr << "UYARI: Paket datagram boyutunu aşıyor." << std::endl;
+                    continue;
+                }
+                batch_iovecs_[batch_count].iov_base = slot;
+                batch_iovecs_[batch_count].iov_len = size;
+                batch_headers_[batch_count] = mmsghdr{};
+                batch_headers_[batch_count].msg_hdr.msg_iov = &batch_iovecs_[batch_count];
+                batch_headers_[batch_count].msg_hdr.msg_iovlen = 1;
+                batch_headers_[batch_count].msg_hdr.msg_name = const_cast<sockaddr_in*>(destination);
+                batch_headers_[batch_count].msg_hdr.msg_namelen = sizeof(server_address_);
+                ++batch_count;
+            }
+            if (batch_count == 0) { continue; }
+
+            int sent = queue_size_ > 0 ? 0 : sendmmsg(socket_, batch_headers_.data(), batch_count, 0);
+            if (sent < 0) {
+                if (!would_block()) {
+                    report_send_error();
+                    dropped_count_.fetch_add(batch_count, std::memory_order_relaxed);
+                    return;
+                }
+                sent = 0;
+            }
+            sent_count_.fetch_add(static_cast<uint64_t>(sent), std::memory_order_relaxed);
+            // Soket tamponu dolu (ya da önceden bekleyen var): kalanlar sıraya girer
+            for (unsigned int i = static_cast<unsigned int>(sent); i < batch_count; ++i) {
+                enqueue_locked(static_cast<const uint8_t*>(batch_iovecs_[i].iov_base), batch_iovecs_[i].iov_len,
+                               *static_cast<const sockaddr_in*>(batch_headers_[i].msg_hdr.msg_name));
+            }
+        }
+#else
+        for (size_t i = 0; i < packets.size(); ++i) {
+            size_t size = packets[i].serialize(send_buffer_.data(), MAX_DATAGRAM_SIZE);
+            if (size == 0) { continue; }
+            const sockaddr_in* destination = destinations ? &destinations[i] : &server_address_;
+            send_one_locked(send_buffer_.data(), size, *destination);
+        }
+#endif
+    }
+
+    void UdpSender::report_send_error() {
+#ifdef _WIN32
+        int error = WSAGetLastError();
+        if (error != WSAEWOULDBLOCK) {
+            std::cerr << "UDP Send hatası: " << error << std::endl;
+        }
+#else
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            std::cerr << "UDP Send hatası: " << strerror(errno) << std::endl;
+        }
+#endif
     }
 }
\ No newline at end of file
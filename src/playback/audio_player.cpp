@@ -2,11 +2,18 @@
 #include <iostream>
 #include <stdexcept>
 #include <cstring>
+#include <algorithm>
+#include <cmath>
 
 
 namespace playback {
 
-AudioPlayer::AudioPlayer() = default;
+AudioPlayer::AudioPlayer() {
+    // Callback içinde allocation olmaması için önceden ayır
+    playback_frame_.reserve(FRAMES_PER_BUFFER * NUM_CHANNELS);
+    scaled_.resize(processing::TimeScaleModifier::max_output(SAMPLE_RATE / 10));
+    resampled_.resize(processing::FractionalResampler::max_output(scaled_.size()));
+}
 AudioPlayer::~AudioPlayer() { stop(); }
 
 bool AudioPlayer::start() {
@@ -41,22 +48,76 @@ void AudioPlayer::stop() {
 }
 
 void AudioPlayer::submit_audio_data(const std::vector<int16_t>& audio_data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex_);
-    
-    // Buffer overflow protection
-    const size_t max_buffer_size = SAMPLE_RATE * NUM_CHANNELS * 2; // 2 saniye max buffer
-    if (audio_buffer_.size() + audio_data.size() > max_buffer_size) {
-        // Eski veriyi sil, yeni veriyi ekle (minimum latency için)
-        size_t excess = (audio_buffer_.size() + audio_data.size()) - max_buffer_size;
-        if (excess < audio_buffer_.size()) {
-            audio_buffer_.erase(audio_buffer_.begin(), audio_buffer_.begin() + excess);
-        } else {
-            audio_buffer_.clear();
+    submit_audio_data(audio_data.data(), audio_data.size());
+}
+
+void AudioPlayer::submit_audio_data(const int16_t* samples, size_t count) {
+    if (!samples || count == 0) { return; }
+
+    // Tampon boşa düştüyse (underrun ya da DTX sessizliği) doluluk geçmişi kaymayı, son verilen
+    // çıkış da bu bloğun öncülünü yansıtmaz
+    const uint64_t underruns = underrun_count_.load(std::memory_order_relaxed);
+    const bool silence_ended = resume_pending_.exchange(false, std::memory_order_acq_rel);
+    const bool resumed = underruns != seen_underruns_ || silence_ended;
+    seen_underruns_ = underruns;
+    const size_t buffered = audio_buffer_.size();
+    const size_t input_count = count;
+
+    if (latency_control_) {
+        if (resumed) { time_scaler_.reset(); }
+        const auto mode = choose_time_scale(buffered, count, resumed);
+        const size_t capacity = processing::TimeScaleModifier::max_output(count);
+        if (scaled_.size() < capacity) { scaled_.resize(capacity); }
+        const size_t scaled = time_scaler_.process(samples, count, mode, scaled_.data());
+        if (scaled < count) {
+            accelerated_samples_.fetch_add(count - scaled, std::memory_order_relaxed);
+        } else if (scaled > count) {
+            expanded_samples_.fetch_add(scaled - count, std::memory_order_relaxed);
         }
-        std::cout << "UYARI: Audio buffer overflow, eski veriler temizlendi." << std::endl;
+        time_scale_credit_ -= std::fabs(static_cast<double>(scaled) - static_cast<double>(count));
+        count = scaled;
+        samples = scaled_.data();
+    }
+
+    if (drift_compensation_) {
+        if (resumed) { drift_estimator_.hold(); }
+        // Zaman tabanı alınan (ölçeklenmemiş) ses süresidir
+        resampler_.set_ratio(drift_estimator_.update(buffered, input_count));
+        drift_ppm_.store(drift_estimator_.drift_ppm(), std::memory_order_relaxed);
+        const size_t capacity = processing::FractionalResampler::max_output(count);
+        if (resampled_.size() < capacity) { resampled_.resize(capacity); }
+        count = resampler_.process(samples, count, resampled_.data());
+        samples = resampled_.data();
+        if (count == 0) { return; }
+    }
+
+    // Buffer overflow protection: SPSC tamponda eski veri üretici tarafından silinemez,
+    // sığmayan yeni veri atılır ve sayaçlara yansıtılır.
+    size_t written = audio_buffer_.write(samples, count);
+    if (written < count) {
+        overrun_count_.fetch_add(1, std::memory_order_relaxed);
+        dropped_samples_.fetch_add(count - written, std::memory_order_relaxed);
+    }
+    has_received_data_.store(true, std::memory_order_relaxed);
+}
+
+processing::TimeScaleModifier::Mode AudioPlayer::choose_time_scale(size_t buffered, size_t count, bool resumed) {
+    using Mode = processing::TimeScaleModifier::Mode;
+    // Ortalama hız değişimi sınırı: her blok bütçeye MAX_TIME_SCALE_RATE kadar ekler,
+    // çıkarılan/eklenen periyot bütçeden düşülür (bir periyottan fazla birikmez)
+    time_scale_credit_ = std::min(time_scale_credit_ + static_cast<double>(count) * MAX_TIME_SCALE_RATE,
+                                  static_cast<double>(processing::TimeScaleModifier::MAX_PERIOD));
+    if (resumed || time_scale_credit_ < static_cast<double>(processing::TimeScaleModifier::MIN_PERIOD)) {
+        return Mode::Normal;
     }
-    
-    audio_buffer_.insert(audio_buffer_.end(), audio_data.begin(), audio_data.end());
+    const size_t target = drift_estimator_.target();
+    if (buffered > target + ACCELERATE_MARGIN) {
+        return Mode::Accelerate;   // Jitter sıçraması sonrası birikmiş gecikmeyi erit
+    }
+    if (buffered < target / 4) {
+        return Mode::Expand;       // Tampon tükenmek üzere: underrun yerine yavaşla
+    }
+    return Mode::Normal;
 }
 
 bool AudioPlayer::is_playing() const {
@@ -67,33 +128,55 @@ void AudioPlayer::set_playback_callback(PlaybackCallback cb) {
     playback_callback_ = std::move(cb);
 }
 
+void AudioPlayer::start_comfort_noise(uint8_t level) {
+    comfort_noise_level_.store(std::min<int>(level, processing::ComfortNoiseGenerator::SILENCE_LEVEL), std::memory_order_relaxed);
+    resume_pending_.store(true, std::memory_order_release);
+}
+
+void AudioPlayer::stop_comfort_noise() {
+    comfort_noise_level_.store(-1, std::memory_order_relaxed);
+}
+
+AudioPlayer::PlayoutStats AudioPlayer::get_stats() const {
+    PlayoutStats stats;
+    stats.underruns = underrun_count_.load(std::memory_order_relaxed);
+    stats.overruns = overrun_count_.load(std::memory_order_relaxed);
+    stats.dropped_samples = dropped_samples_.load(std::memory_order_relaxed);
+    stats.comfort_noise_samples = comfort_noise_samples_.load(std::memory_order_relaxed);
+    stats.buffered_samples = audio_buffer_.size();
+    stats.target_samples = drift_estimator_.target();
+    stats.drift_ppm = drift_ppm_.load(std::memory_order_relaxed);
+    stats.accelerated_samples = accelerated_samples_.load(std::memory_order_relaxed);
+    stats.expanded_samples = expanded_samples_.load(std::memory_order_relaxed);
+    return stats;
+}
+
 int AudioPlayer::pa_callback(const void*, void* o, unsigned long f, const PaStreamCallbackTimeInfo*, PaStreamCallbackFlags, void* u) {
-    return static_cast<AudioPlayer*>(u)->process(static_cast<int16_t*>(o), f);
+    static_cast<AudioPlayer*>(u)->render(static_cast<int16_t*>(o), f);
+    return paContinue;
 }
 
-int AudioPlayer::process(int16_t* outputBuffer, unsigned long framesPerBuffer) {
-    std::lock_guard<std::mutex> lock(buffer_mutex_);
+void AudioPlayer::render(int16_t* outputBuffer, size_t framesPerBuffer) {
     const size_t samples_needed = framesPerBuffer * NUM_CHANNELS;
-    
-    if (audio_buffer_.size() >= samples_needed) {
-        std::memcpy(outputBuffer, audio_buffer_.data(), samples_needed * sizeof(int16_t));
-        audio_buffer_.erase(audio_buffer_.begin(), audio_buffer_.begin() + samples_needed);
-    } else {
-        // Underrun protection - kısmen dolu buffer'ı kullan
-        if (!audio_buffer_.empty()) {
-            std::memcpy(outputBuffer, audio_buffer_.data(), audio_buffer_.size() * sizeof(int16_t));
-            std::memset(outputBuffer + audio_buffer_.size(), 0, 
-                       (samples_needed - audio_buffer_.size()) * sizeof(int16_t));
-            audio_buffer_.clear();
-        } else {
-            // Tamamen boş buffer - silence
-            std::memset(outputBuffer, 0, samples_needed * sizeof(int16_t));
+
+    // Kilitsiz okuma; eksik kalan kısım sessizlikle doldurulur (underrun)
+    size_t samples_read = audio_buffer_.read(outputBuffer, samples_needed);
+    const int noise_level = comfort_noise_level_.load(std::memory_order_relaxed);
+    if (samples_read < samples_needed && noise_level >= 0) {
+        // Karşı taraf sessizlikte: eksik kısım kayıp değil, yerel konfor gürültüsü
+        comfort_noise_.set_level(static_cast<uint8_t>(noise_level));
+        comfort_noise_.generate(outputBuffer + samples_read, samples_needed - samples_read);
+        comfort_noise_samples_.fetch_add(samples_needed - samples_read, std::memory_order_relaxed);
+    } else if (samples_read < samples_needed) {
+        std::memset(outputBuffer + samples_read, 0, (samples_needed - samples_read) * sizeof(int16_t));
+        if (has_received_data_.load(std::memory_order_relaxed)) {
+            underrun_count_.fetch_add(1, std::memory_order_relaxed);
         }
     }
-    
+
     if (playback_callback_) {
-        playback_callback_(std::vector<int16_t>(outputBuffer, outputBuffer + samples_needed));
+        playback_frame_.assign(outputBuffer, outputBuffer + samples_needed);
+        playback_callback_(playback_frame_);
     }
-    return paContinue;
 }
 }
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "playback/drift_estimator.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace playback {
+    DriftEstimator::DriftEstimator() : DriftEstimator(Config{}) {}
+
+    DriftEstimator::DriftEstimator(const Config& config) : config_(config) {}
+
+    void DriftEstimator::reset() {
+        smoothed_fill_ = 0.0;
+        drift_ = 0.0;
+        ratio_ = 1.0;
+        holding_ = true;
+    }
+
+    double DriftEstimator::update(size_t buffered_samples, size_t submitted_samples) {
+        const double fill = static_cast<double>(buffered_samples);
+        if (holding_) {
+            // Boşalmış tamponun ilk ölçümü saat kaymasını göstermez; ortalama buradan başlar
+            smoothed_fill_ = fill;
+            holding_ = false;
+            return ratio_;
+        }
+        const double rate = static_cast<double>(config_.sample_rate);
+        const double elapsed = static_cast<double>(submitted_samples) / rate;
+        const double alpha = 1.0 - std::exp(-elapsed / config_.smoothing_seconds);
+        smoothed_fill_ += alpha * (fill - smoothed_fill_);
+
+        const double error_seconds = (smoothed_fill_ - static_cast<double>(config_.target_samples)) / rate;
+        if (std::fabs(error_seconds) <= config_.max_tracking_error_seconds) {
+            drift_ += config_.correction_per_second * error_seconds * elapsed / config_.integral_seconds;
+            drift_ = std::clamp(drift_, -config_.max_correction, config_.max_correction);
+        }
+        const double correction = drift_ + config_.correction_per_second * error_seconds;
+        ratio_ = 1.0 - std::clamp(correction, -config_.max_correction, config_.max_correction);
+        return ratio_;
+    }
+}
@@ -0,0 +1,39 @@
+#include "processing/audio_frame.hpp"
+#include "processing/dsp_kernels.hpp"
+#include <cmath>
+
+namespace processing {
+uint64_t AudioFrame::energy() const {
+    if (!(valid_ & ENERGY)) {
+        energy_ = sum_of_squares(samples_.data(), samples_.size());
+        valid_ |= ENERGY;
+    }
+    return energy_;
+}
+
+float AudioFrame::mean_energy() const {
+    if (samples_.empty()) { return 0.0f; }
+    return static_cast<float>(energy()) / samples_.size();
+}
+
+float AudioFrame::rms() const {
+    return std::sqrt(mean_energy());
+}
+
+int32_t AudioFrame::peak() const {
+    if (!(valid_ & PEAK)) {
+        peak_ = peak_abs(samples_.data(), samples_.size());
+        valid_ |= PEAK;
+    }
+    return peak_;
+}
+
+float AudioFrame::zero_crossing_rate() const {
+    if (samples_.size() < 2) { return 0.0f; }
+    if (!(valid_ & ZERO_CROSSINGS)) {
+        zero_crossings_ = zero_crossings(samples_.data(), samples_.size());
+        valid_ |= ZERO_CROSSINGS;
+    }
+    return static_cast<float>(zero_crossings_) / (samples_.size() - 1);
+}
+}
@@ -1,77 +1,124 @@
 #include "processing/audio_gain_controller.hpp"
+#include "processing/dsp_kernels.hpp"
 #include <cmath>
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 
 namespace processing {
 
-AudioGainController::AudioGainController(
-    float target_level,
-    float max_gain,
-    float min_gain,
-    float attack_rate,
-    float release_rate)
-    : target_level_(target_level),
-      max_gain_(max_gain),
-      min_gain_(min_gain),
-      attack_rate_(attack_rate),
-      release_rate_(release_rate),
-      current_gain_(1.0f),
-      current_level_(0.0f) {
-    
-    std::cout << "Audio Gain Controller başlatıldı - Target Level: " << target_level_ << std::endl;
+static_assert(AudioGainController::BLOCK <= AudioGainController::LOOKAHEAD,
+              "Blok tepe noktası bir önceki bloğun ileri bakış penceresinde kalmalı");
+
+AudioGainController::AudioGainController() : AudioGainController(Config{}) {}
+
+AudioGainController::AudioGainController(const Config& config)
+    : config_(config),
+      history_(LOOKAHEAD, 0) {
+    window_.reserve(LOOKAHEAD + 960);
+    std::cout << "Audio Gain Controller başlatıldı - Target Level: " << config_.target_level
+              << ", Limiter: " << config_.limit_level << " (" << LOOKAHEAD << " örnek ileri bakış)" << std::endl;
+}
+
+void AudioGainController::process(std::vector<int16_t>& samples) {
+    process(samples.data(), samples.size());
+}
+
+void AudioGainController::process(AudioFrame& frame) {
+    if (frame.empty()) return;
+    const float rms = frame.rms();
+    process(frame.mutable_data(), frame.size(), rms);
+}
+
+void AudioGainController::process(int16_t* samples, size_t count) {
+    if (!samples || count == 0) return;
+    const uint64_t sum = sum_of_squares(samples, count);
+    process(samples, count, std::sqrt(static_cast<float>(sum) / count));
 }
 
-float AudioGainController::calculate_rms(const std::vector<int16_t>& samples) {
-    if (samples.empty()) return 0.0f;
-    
-    float sum = 0.0f;
-    for (const auto& sample : samples) {
-        sum += static_cast<float>(sample * sample);
+void AudioGainController::process(int16_t* samples, size_t count, float rms) {
+    // Mevcut RMS seviyesine göre bu çerçevenin sonunda ulaşılacak kazanç
+    update_gain(rms);
+
+    // Pencere: gecikmiş LOOKAHEAD örnek + yeni çerçeve. Çıkış pencerenin ilk count örneğidir.
+    window_.resize(LOOKAHEAD + count);
+    std::memcpy(window_.data(), history_.data(), LOOKAHEAD * sizeof(int16_t));
+    std::memcpy(window_.data() + LOOKAHEAD, samples, count * sizeof(int16_t));
+    std::memcpy(samples, window_.data(), count * sizeof(int16_t));
+    std::memcpy(history_.data(), window_.data() + count, LOOKAHEAD * sizeof(int16_t));
+
+    // AGC kazancı çerçeve boyunca applied_gain_ -> current_gain_ rampası; sınırlayıcı bu rampanın
+    // çerçevedeki en büyük değerini varsayar (tavan hiçbir örnekte aşılmaz)
+    const float agc_start = applied_gain_;
+    const float agc_step = (current_gain_ - applied_gain_) / static_cast<float>(count);
+    const float agc_peak = std::max(applied_gain_, current_gain_);
+    uint64_t limited = 0;
+
+    for (size_t position = 0; position < count; position += BLOCK) {
+        const size_t length = std::min(BLOCK, count - position);
+        // Bu bloğun ve ardından gelecek LOOKAHEAD örneğin tepesi
+        const float peak = static_cast<float>(peak_abs(window_.data() + position, length + LOOKAHEAD)) * agc_peak;
+        const float required = peak > config_.limit_level ? config_.limit_level / peak : 1.0f;
+        float target;
+        if (required < limiter_gain_) {
+            target = required;   // Atak: tepe bu bloğun sonundan önce gelemez (pencere onu zaten kapsıyordu)
+            ++limited;
+        } else {
+            target = std::min(required, limiter_gain_ + (1.0f - limiter_gain_) * config_.limiter_release);
+        }
+        const float start = (agc_start + agc_step * static_cast<float>(position)) * limiter_gain_;
+        const float end = (agc_start + agc_step * static_cast<float>(position + length)) * target;
+        const float step = (end - start) / static_cast<float>(length);
+        apply_gain_ramp(samples + position, length, start + step, step);
+        limiter_gain_ = target;
+    }
+    applied_gain_ = current_gain_;
+
+    published_gain_.store(current_gain_, std::memory_order_relaxed);
+    published_limiter_gain_.store(limiter_gain_, std::memory_order_relaxed);
+    if (limited > 0) {
+        limited_blocks_.fetch_add(limited, std::memory_order_relaxed);
     }
-    
-    return std::sqrt(sum / samples.size());
 }
 
-void AudioGainController::process(std::vector<int16_t>& samples) {
-    if (samples.empty()) return;
-    
-    // Mevcut RMS seviyesini hesapla
-    float rms = calculate_rms(samples);
-    
+void AudioGainController::update_gain(float rms) {
     // Smooth level tracking
     if (rms > current_level_) {
-        current_level_ = attack_rate_ * rms + (1.0f - attack_rate_) * current_level_;
+        current_level_ = config_.attack_rate * rms + (1.0f - config_.attack_rate) * current_level_;
     } else {
-        current_level_ = release_rate_ * rms + (1.0f - release_rate_) * current_level_;
+        current_level_ = config_.release_rate * rms + (1.0f - config_.release_rate) * current_level_;
     }
-    
+
     // Gain hesapla
     if (current_level_ > 10.0f) { // Minimum threshold
-        float desired_gain = target_level_ / current_level_;
-        desired_gain = std::clamp(desired_gain, min_gain_, max_gain_);
-        
+        float desired_gain = config_.target_level / current_level_;
+        desired_gain = std::clamp(desired_gain, config_.min_gain, config_.max_gain);
+
         // Smooth gain changes
         if (desired_gain > current_gain_) {
-            current_gain_ = attack_rate_ * desired_gain + (1.0f - attack_rate_) * current_gain_;
+            current_gain_ = config_.attack_rate * desired_gain + (1.0f - config_.attack_rate) * current_gain_;
         } else {
-            current_gain_ = release_rate_ * desired_gain + (1.0f - release_rate_) * current_gain_;
+            current_gain_ = config_.release_rate * desired_gain + (1.0f - config_.release_rate) * current_gain_;
         }
     }
-    
-    // Gain'i uygula
-    for (auto& sample : samples) {
-        float processed = static_cast<float>(sample) * current_gain_;
-        
-        // Clipping protection
-        processed = std::clamp(processed, -32767.0f, 32767.0f);
-        sample = static_cast<int16_t>(processed);
-    }
 }
 
 void AudioGainController::reset() {
     current_gain_ = 1.0f;
+    applied_gain_ = 1.0f;
     current_level_ = 0.0f;
+    limiter_gain_ = 1.0f;
+    std::fill(history_.begin(), history_.end(), 0);
+    published_gain_.store(1.0f, std::memory_order_relaxed);
+    published_limiter_gain_.store(1.0f, std::memory_order_relaxed);
 }
 
-}
\ No newline at end of file
+AudioGainController::Stats AudioGainController::get_stats() const {
+    Stats stats;
+    stats.gain = published_gain_.load(std::memory_order_relaxed);
+    stats.limiter_gain = published_limiter_gain_.load(std::memory_order_relaxed);
+    stats.limited_blocks = limited_blocks_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}
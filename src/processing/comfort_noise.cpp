@@ -0,0 +1,53 @@
+#include "processing/comfort_noise.hpp"
+#include "processing/dsp_kernels.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace processing {
+    namespace {
+        constexpr float FULL_SCALE = 32768.0f;
+        // Tek kutuplu alçak geçiren: y = a*y + (1-a)*x. Beyaz gürültünün RMS'i
+        // sqrt((1-a)/(1+a)) ile çarpılır; uniform [-1, 1) RMS'i 1/sqrt(3).
+        constexpr float LOWPASS_POLE = 0.5f;
+        const float NOISE_RMS_CORRECTION = std::sqrt(3.0f) * std::sqrt((1.0f + LOWPASS_POLE) / (1.0f - LOWPASS_POLE));
+        constexpr float GAIN_SMOOTHING = 0.002f;    // ~10ms @ 48kHz
+    }
+
+    uint8_t ComfortNoiseGenerator::level_from_samples(const int16_t* samples, size_t count) {
+        if (!samples || count == 0) { return SILENCE_LEVEL; }
+        const double mean_square = static_cast<double>(sum_of_squares(samples, count)) / static_cast<double>(count);
+        if (mean_square <= 0.0) { return SILENCE_LEVEL; }
+        const double dbov = 10.0 * std::log10(mean_square / (static_cast<double>(FULL_SCALE) * FULL_SCALE));
+        return static_cast<uint8_t>(std::clamp(-dbov, 0.0, static_cast<double>(SILENCE_LEVEL)) + 0.5);
+    }
+
+    float ComfortNoiseGenerator::level_to_rms(uint8_t level) {
+        if (level >= SILENCE_LEVEL) { return 0.0f; }
+        return FULL_SCALE * std::pow(10.0f, -static_cast<float>(level) / 20.0f);
+    }
+
+    ComfortNoiseGenerator::ComfortNoiseGenerator(uint32_t seed) : state_(seed ? seed : 1u) {}
+
+    void ComfortNoiseGenerator::set_level(uint8_t level) {
+        level_ = std::min(level, SILENCE_LEVEL);
+        target_gain_ = level_to_rms(level_) * NOISE_RMS_CORRECTION;
+    }
+
+    uint32_t ComfortNoiseGenerator::next_random() {
+        // xorshift32: ses thread'inde ayırma ve kilit yok
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 17;
+        state_ ^= state_ << 5;
+        return state_;
+    }
+
+    void ComfortNoiseGenerator::generate(int16_t* out, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            const float white = static_cast<float>(static_cast<int32_t>(next_random())) / 2147483648.0f;
+            lowpass_ = LOWPASS_POLE * lowpass_ + (1.0f - LOWPASS_POLE) * white;
+            gain_ += (target_gain_ - gain_) * GAIN_SMOOTHING;
+            const float sample = lowpass_ * gain_;
+            out[i] = static_cast<int16_t>(std::clamp(sample, -32768.0f, 32767.0f));
+        }
+    }
+}
@@ -0,0 +1,432 @@
+#include "processing/dsp_kernels.hpp"
+#include <algorithm>
+#include <cmath>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define VOICE_ENGINE_DSP_X86 1
+#include <immintrin.h>
+#define DSP_TARGET_SSE2 __attribute__((target("sse2")))
+#define DSP_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace processing {
+namespace {
+    constexpr float MAX_GAIN = 65535.0f; // |int16 * gain| < 2^31: vektör dönüşümü taşmaz
+
+    inline int16_t saturate16(int32_t value) {
+        return static_cast<int16_t>(std::clamp<int32_t>(value, -32768, 32767));
+    }
+
+    inline float clamp_gain(float gain) {
+        return std::clamp(gain, -MAX_GAIN, MAX_GAIN);
+    }
+
+    // ---- Scalar referans ----
+
+    uint64_t sum_of_squares_scalar(const int16_t* samples, size_t count) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const int32_t s = samples[i];
+            sum += static_cast<uint64_t>(s * s);
+        }
+        return sum;
+    }
+
+    int32_t peak_abs_scalar(const int16_t* samples, size_t count) {
+        int32_t max_value = 0;
+        int32_t min_value = 0;
+        for (size_t i = 0; i < count; ++i) {
+            max_value = std::max<int32_t>(max_value, samples[i]);
+            min_value = std::min<int32_t>(min_value, samples[i]);
+        }
+        return std::max(max_value, -min_value);
+    }
+
+    size_t zero_crossings_scalar(const int16_t* samples, size_t count) {
+        size_t crossings = 0;
+        for (size_t i = 1; i < count; ++i) {
+            crossings += static_cast<size_t>((samples[i - 1] < 0) != (samples[i] < 0));
+        }
+        return crossings;
+    }
+
+    // Vektör yollarıyla aynı sonuç için: tek float çarpma, geçerli yuvarlama kipinde
+    // (varsayılan: en yakın çifte) tamsayıya dönüşüm, ardından doyurma.
+    void apply_gain_scalar_tail(int16_t* samples, size_t count, float gain) {
+        for (size_t i = 0; i < count; ++i) {
+            const float product = static_cast<float>(samples[i]) * gain;
+            samples[i] = saturate16(static_cast<int32_t>(std::lrintf(product)));
+        }
+    }
+
+    void apply_gain_scalar(int16_t* samples, size_t count, float gain) {
+        apply_gain_scalar_tail(samples, count, clamp_gain(gain));
+    }
+
+    // Vektör yolları i'yi float'a çevirip aynı çarpma/toplama sırasını izler (FMA yok): bit düzeyinde aynı
+    void apply_gain_ramp_scalar_tail(int16_t* samples, size_t count, float gain, float step, size_t first) {
+        for (size_t i = 0; i < count; ++i) {
+            const float current = gain + step * static_cast<float>(first + i);
+            const float product = static_cast<float>(samples[i]) * current;
+            samples[i] = saturate16(static_cast<int32_t>(std::lrintf(product)));
+        }
+    }
+
+    void apply_gain_ramp_scalar(int16_t* samples, size_t count, float gain, float step) {
+        apply_gain_ramp_scalar_tail(samples, count, gain, step, 0);
+    }
+
+    void mix_saturate_scalar(int16_t* dst, const int16_t* src, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = saturate16(static_cast<int32_t>(dst[i]) + src[i]);
+        }
+    }
+
+    void subtract_saturate_scalar(int16_t* dst, const int16_t* src, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = saturate16(static_cast<int32_t>(dst[i]) - src[i]);
+        }
+    }
+
+    int64_t dot_product_scalar(const int16_t* a, const int16_t* b, size_t count) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            sum += static_cast<int32_t>(a[i]) * b[i];
+        }
+        return sum;
+    }
+
+    constexpr DspKernels SCALAR_KERNELS = {
+        sum_of_squares_scalar,
+        peak_abs_scalar,
+        zero_crossings_scalar,
+        apply_gain_scalar,
+        apply_gain_ramp_scalar,
+        mix_saturate_scalar,
+        subtract_saturate_scalar,
+        dot_product_scalar,
+    };
+
+#if defined(VOICE_ENGINE_DSP_X86)
+    // ---- SSE2: 8 örnek / iterasyon ----
+
+    DSP_TARGET_SSE2 uint64_t sum_of_squares_sse2(const int16_t* samples, size_t count) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i acc = zero;
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+            // Çift toplamı en fazla 2 * 32768^2 = 2^31: işaretsiz 32 bit olarak doğru, 64 bite genişletilir
+            const __m128i pairs = _mm_madd_epi16(v, v);
+            acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(pairs, zero));
+            acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(pairs, zero));
+        }
+        alignas(16) uint64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        return lanes[0] + lanes[1] + sum_of_squares_scalar(samples + i, count - i);
+    }
+
+    DSP_TARGET_SSE2 int32_t peak_abs_sse2(const int16_t* samples, size_t count) {
+        __m128i max_v = _mm_setzero_si128();
+        __m128i min_v = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+            max_v = _mm_max_epi16(max_v, v);
+            min_v = _mm_min_epi16(min_v, v);
+        }
+        alignas(16) int16_t max_lanes[8];
+        alignas(16) int16_t min_lanes[8];
+        _mm_store_si128(reinterpret_cast<__m128i*>(max_lanes), max_v);
+        _mm_store_si128(reinterpret_cast<__m128i*>(min_lanes), min_v);
+        int32_t peak = peak_abs_scalar(samples + i, count - i);
+        for (int lane = 0; lane < 8; ++lane) {
+            peak = std::max({peak, static_cast<int32_t>(max_lanes[lane]), -static_cast<int32_t>(min_lanes[lane])});
+        }
+        return peak;
+    }
+
+    DSP_TARGET_SSE2 size_t zero_crossings_sse2(const int16_t* samples, size_t count) {
+        if (count < 2) { return 0; }
+        const __m128i zero = _mm_setzero_si128();
+        size_t crossings = 0;
+        size_t i = 1;
+        for (; i + 8 <= count; i += 8) {
+            const __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i - 1));
+            const __m128i curr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+            const __m128i changed = _mm_xor_si128(_mm_cmplt_epi16(prev, zero), _mm_cmplt_epi16(curr, zero));
+            const int mask = _mm_movemask_epi8(_mm_packs_epi16(changed, zero));
+            crossings += static_cast<size_t>(__builtin_popcount(static_cast<unsigned>(mask)));
+        }
+        return crossings + zero_crossings_scalar(samples + i - 1, count - i + 1);
+    }
+
+    DSP_TARGET_SSE2 void apply_gain_sse2(int16_t* samples, size_t count, float gain) {
+        gain = clamp_gain(gain);
+        const __m128 g = _mm_set1_ps(gain);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+            const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+            const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+            const __m128i lo_out = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(lo), g));
+            const __m128i hi_out = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(hi), g));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(samples + i), _mm_packs_epi32(lo_out, hi_out));
+        }
+        apply_gain_scalar_tail(samples + i, count - i, gain);
+    }
+
+    DSP_TARGET_SSE2 void apply_gain_ramp_sse2(int16_t* samples, size_t count, float gain, float step) {
+        const __m128 g = _mm_set1_ps(gain);
+        const __m128 s = _mm_set1_ps(step);
+        const __m128 lo_offsets = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+        const __m128 hi_offsets = _mm_setr_ps(4.0f, 5.0f, 6.0f, 7.0f);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            // float(i) + k tam sayıdır (i < 2^24): scalar'daki float(i + k) ile aynı
+            const __m128 base = _mm_set1_ps(static_cast<float>(i));
+            const __m128 lo_gain = _mm_add_ps(g, _mm_mul_ps(s, _mm_add_ps(base, lo_offsets)));
+            const __m128 hi_gain = _mm_add_ps(g, _mm_mul_ps(s, _mm_add_ps(base, hi_offsets)));
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+            const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+            const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+            const __m128i lo_out = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(lo), lo_gain));
+            const __m128i hi_out = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(hi), hi_gain));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(samples + i), _mm_packs_epi32(lo_out, hi_out));
+        }
+        apply_gain_ramp_scalar_tail(samples + i, count - i, gain, step, i);
+    }
+
+    DSP_TARGET_SSE2 void mix_saturate_sse2(int16_t* dst, const int16_t* src, size_t count) {
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_adds_epi16(a, b));
+        }
+        mix_saturate_scalar(dst + i, src + i, count - i);
+    }
+
+    DSP_TARGET_SSE2 void subtract_saturate_sse2(int16_t* dst, const int16_t* src, size_t count) {
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_subs_epi16(a, b));
+        }
+        subtract_saturate_scalar(dst + i, src + i, count - i);
+    }
+
+    DSP_TARGET_SSE2 int64_t dot_product_sse2(const int16_t* a, const int16_t* b, size_t count) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i overflow = _mm_set1_epi32(INT32_MIN);
+        __m128i acc = zero;
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            // Çift toplamı yalnızca dört girdi de -32768 ise taşar ve tam olarak INT32_MIN olur
+            // (geçerli en küçük toplam -2^31 + 2^16); o durumda değer +2^31'dir, üst yarısı 0 alınır
+            const __m128i pairs = _mm_madd_epi16(va, vb);
+            const __m128i sign = _mm_andnot_si128(_mm_cmpeq_epi32(pairs, overflow), _mm_cmpgt_epi32(zero, pairs));
+            acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(pairs, sign));
+            acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(pairs, sign));
+        }
+        alignas(16) int64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        return lanes[0] + lanes[1] + dot_product_scalar(a + i, b + i, count - i);
+    }
+
+    // ---- AVX2: 16 örnek / iterasyon ----
+
+    DSP_TARGET_AVX2 uint64_t sum_of_squares_avx2(const int16_t* samples, size_t count) {
+        __m256i acc = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(samples + i));
+            const __m256i pairs = _mm256_madd_epi16(v, v);
+            acc = _mm256_add_epi64(acc, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(pairs)));
+            acc = _mm256_add_epi64(acc, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(pairs, 1)));
+        }
+        alignas(32) uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_of_squares_scalar(samples + i, count - i);
+    }
+
+    DSP_TARGET_AVX2 int32_t peak_abs_avx2(const int16_t* samples, size_t count) {
+        __m256i max_v = _mm256_setzero_si256();
+        __m256i min_v = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(samples + i));
+            max_v = _mm256_max_epi16(max_v, v);
+            min_v = _mm256_min_epi16(min_v, v);
+        }
+        alignas(32) int16_t max_lanes[16];
+        alignas(32) int16_t min_lanes[16];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(max_lanes), max_v);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(min_lanes), min_v);
+        int32_t peak = peak_abs_scalar(samples + i, count - i);
+        for (int lane = 0; lane < 16; ++lane) {
+            peak = std::max({peak, static_cast<int32_t>(max_lanes[lane]), -static_cast<int32_t>(min_lanes[lane])});
+        }
+        return peak;
+    }
+
+    DSP_TARGET_AVX2 size_t zero_crossings_avx2(const int16_t* samples, size_t count) {
+        if (count < 2) { return 0; }
+        const __m256i zero = _mm256_setzero_si256();
+        size_t crossings = 0;
+        size_t i = 1;
+        for (; i + 16 <= count; i += 16) {
+            const __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(samples + i - 1));
+            const __m256i curr = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(samples + i));
+            const __m256i changed = _mm256_xor_si256(_mm256_cmpgt_epi16(zero, prev), _mm256_cmpgt_epi16(zero, curr));
+            // Her 16 bitlik eleman maskede 2 bit üretir
+            const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(changed));
+            crossings += static_cast<size_t>(__builtin_popcount(mask)) / 2;
+        }
+        return crossings + zero_crossings_scalar(samples + i - 1, count - i + 1);
+    }
+
+    DSP_TARGET_AVX2 void apply_gain_avx2(int16_t* samples, size_t count, float gain) {
+        gain = clamp_gain(gain);
+        const __m256 g = _mm256_set1_ps(gain);
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(samples + i));
+            const __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v));
+            const __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1));
+            const __m256i lo_out = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(lo), g));
+            const __m256i hi_out = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(hi), g));
+            // packs 128 bitlik şeritler içinde çalışır; sıra permute ile düzeltilir
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo_out, hi_out), 0xD8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(samples + i), packed);
+        }
+        apply_gain_scalar_tail(samples + i, count - i, gain);
+    }
+
+    DSP_TARGET_AVX2 void apply_gain_ramp_avx2(int16_t* samples, size_t count, float gain, float step) {
+        const __m256 g = _mm256_set1_ps(gain);
+        const __m256 s = _mm256_set1_ps(step);
+        const __m256 lo_offsets = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+        const __m256 hi_offsets = _mm256_setr_ps(8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            const __m256 base = _mm256_set1_ps(static_cast<float>(i));
+            const __m256 lo_gain = _mm256_add_ps(g, _mm256_mul_ps(s, _mm256_add_ps(base, lo_offsets)));
+            const __m256 hi_gain = _mm256_add_ps(g, _mm256_mul_ps(s, _mm256_add_ps(base, hi_offsets)));
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(samples + i));
+            const __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v));
+            const __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1));
+            const __m256i lo_out = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(lo), lo_gain));
+            const __m256i hi_out = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(hi), hi_gain));
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo_out, hi_out), 0xD8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(samples + i), packed);
+        }
+        apply_gain_ramp_scalar_tail(samples + i, count - i, gain, step, i);
+    }
+
+    DSP_TARGET_AVX2 void mix_saturate_avx2(int16_t* dst, const int16_t* src, size_t count) {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_adds_epi16(a, b));
+        }
+        mix_saturate_scalar(dst + i, src + i, count - i);
+    }
+
+    DSP_TARGET_AVX2 void subtract_saturate_avx2(int16_t* dst, const int16_t* src, size_t count) {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_subs_epi16(a, b));
+        }
+        subtract_saturate_scalar(dst + i, src + i, count - i);
+    }
+
+    DSP_TARGET_AVX2 int64_t dot_product_avx2(const int16_t* a, const int16_t* b, size_t count) {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i overflow = _mm256_set1_epi32(INT32_MIN);
+        __m256i acc = zero;
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            const __m256i pairs = _mm256_madd_epi16(va, vb);
+            const __m256i sign = _mm256_andnot_si256(_mm256_cmpeq_epi32(pairs, overflow), _mm256_cmpgt_epi32(zero, pairs));
+            acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(pairs, sign));
+            acc = _mm256_add_epi64(acc, _mm256_unpackhi_epi32(pairs, sign));
+        }
+        alignas(32) int64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3] + dot_product_scalar(a + i, b + i, count - i);
+    }
+
+    constexpr DspKernels SSE2_KERNELS = {
+        sum_of_squares_sse2,
+        peak_abs_sse2,
+        zero_crossings_sse2,
+        apply_gain_sse2,
+        apply_gain_ramp_sse2,
+        mix_saturate_sse2,
+        subtract_saturate_sse2,
+        dot_product_sse2,
+    };
+
+    constexpr DspKernels AVX2_KERNELS = {
+        sum_of_squares_avx2,
+        peak_abs_avx2,
+        zero_crossings_avx2,
+        apply_gain_avx2,
+        apply_gain_ramp_avx2,
+        mix_saturate_avx2,
+        subtract_saturate_avx2,
+        dot_product_avx2,
+    };
+#endif
+
+    SimdLevel detect_simd_level() {
+#if defined(VOICE_ENGINE_DSP_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) { return SimdLevel::Avx2; }
+        if (__builtin_cpu_supports("sse2")) { return SimdLevel::Sse2; }
+#endif
+        return SimdLevel::Scalar;
+    }
+}
+
+SimdLevel dsp_simd_level() {
+    static const SimdLevel level = detect_simd_level();
+    return level;
+}
+
+const char* dsp_simd_level_name(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Avx2: return "avx2";
+        case SimdLevel::Sse2: return "sse2";
+        case SimdLevel::Scalar: break;
+    }
+    return "scalar";
+}
+
+const DspKernels& dsp_kernels(SimdLevel level) {
+    // İstenen seviye CPU'nun desteklediğinden yüksekse desteklenen en iyi seviyeye düşülür
+    const SimdLevel supported = dsp_simd_level();
+    if (static_cast<int>(level) > static_cast<int>(supported)) {
+        level = supported;
+    }
+#if defined(VOICE_ENGINE_DSP_X86)
+    if (level == SimdLevel::Avx2) { return AVX2_KERNELS; }
+    if (level == SimdLevel::Sse2) { return SSE2_KERNELS; }
+#endif
+    return SCALAR_KERNELS;
+}
+
+const DspKernels& dsp_kernels() {
+    static const DspKernels& active = dsp_kernels(dsp_simd_level());
+    return active;
+}
+}
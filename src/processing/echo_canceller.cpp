@@ -1,90 +1,199 @@
 #include "processing/echo_canceller.hpp"
 #include <algorithm>
 #include <cmath>
-#include <mutex>
+#include <cstring>
 #include <iostream>
 
 namespace processing {
-EchoCanceller::EchoCanceller(size_t max_delay_samples)
-    : max_delay_(max_delay_samples),
-      echo_suppression_factor_(0.8f), // %80 echo bastırma
-      adaptive_threshold_(1000.0f),
-      learning_rate_(0.01f) {
-    
-    std::cout << "Agresif Echo Canceller başlatıldı - Max Delay: " << max_delay_samples << std::endl;
+namespace {
+    constexpr float SAMPLE_SCALE = 1.0f / 32768.0f;
+    constexpr float STEP_SIZE = 0.5f;               // NLMS adımı (0 < mu < 1)
+    constexpr float POWER_SMOOTHING = 0.7f;         // Bin gücü için üstel ortalama katsayısı
+    constexpr float REGULARIZATION = 1e-6f * EchoCanceller::FFT_SIZE;
+    constexpr float MIN_FAR_ENERGY = 1e-7f;         // ~-70 dBFS altı uzak uç: uyarlama yok
+    constexpr float CONVERGED_ERLE = 4.0f;          // ~6 dB
+    constexpr float DOUBLE_TALK_RATIO = 4.0f;       // Blok ERLE'si ortalamadan ~6 dB kötüyse çift konuşma
+    constexpr size_t MAX_FROZEN_BLOCKS = 750;       // ~2 s: yankı yolu değişmiş say, uyarlamayı aç
+}
+
+EchoCanceller::EchoCanceller(int tail_length_ms, int sample_rate)
+    : partitions_(std::max<size_t>(1, (static_cast<size_t>(std::max(tail_length_ms, 1)) * static_cast<size_t>(sample_rate) / 1000
+                                       + BLOCK_SIZE - 1) / BLOCK_SIZE)),
+      max_far_backlog_(static_cast<size_t>(sample_rate) / 50),
+      far_queue_(static_cast<size_t>(sample_rate)),
+      fft_(FFT_SIZE),
+      far_time_(FFT_SIZE),
+      far_re_(partitions_ * BINS),
+      far_im_(partitions_ * BINS),
+      far_power_(BINS),
+      weight_re_(partitions_ * BINS),
+      weight_im_(partitions_ * BINS),
+      spectrum_re_(BINS),
+      spectrum_im_(BINS),
+      time_buffer_(FFT_SIZE),
+      error_(FFT_SIZE),
+      far_block_(BLOCK_SIZE),
+      near_block_(BLOCK_SIZE),
+      out_block_(BLOCK_SIZE) {
+
+    std::cout << "Echo Canceller (PBFDAF) başlatıldı - Kuyruk: " << tail_length_ms << "ms, "
+              << partitions_ << " bölüm x " << BLOCK_SIZE << " örnek" << std::endl;
 }
 
 void EchoCanceller::on_playback(const std::vector<int16_t>& samples) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    // Playback buffer'a ekle
-    echo_buffer_.insert(echo_buffer_.end(), samples.begin(), samples.end());
-    
-    // Buffer boyutunu kontrol et
-    if (echo_buffer_.size() > max_delay_) {
-        echo_buffer_.erase(echo_buffer_.begin(), echo_buffer_.end() - max_delay_);
-    }
-    
-    // RMS hesapla playback için
-    float rms = 0.0f;
-    for (const auto& sample : samples) {
-        rms += static_cast<float>(sample * sample);
+    on_playback(samples.data(), samples.size());
+}
+
+void EchoCanceller::on_playback(const int16_t* samples, size_t count) {
+    // Kuyruk doluysa fazlası düşer; process() tarafı birikmeyi sınırlar
+    far_queue_.write(samples, count);
+}
+
+void EchoCanceller::process(std::vector<int16_t>& capture) {
+    process(capture.data(), capture.size());
+}
+
+void EchoCanceller::process(int16_t* capture, size_t count) {
+    // Uzak uç referansı mikrofondaki yankıdan önde kalmalı: birikmiş fazlalık atılır
+    const size_t backlog = far_queue_.size();
+    if (backlog > max_far_backlog_ + count) {
+        far_queue_.discard(backlog - max_far_backlog_ - count);
     }
-    rms = std::sqrt(rms / samples.size());
-    
-    // Adaptif threshold güncelle
-    if (rms > 100.0f) { // Aktif playback varsa
-        adaptive_threshold_ = learning_rate_ * rms + (1.0f - learning_rate_) * adaptive_threshold_;
+
+    for (size_t i = 0; i < count; ++i) {
+        near_block_[block_fill_] = static_cast<float>(capture[i]) * SAMPLE_SCALE;
+        capture[i] = out_block_[block_fill_];
+        if (++block_fill_ == BLOCK_SIZE) {
+            process_block();
+            block_fill_ = 0;
+        }
     }
 }
 
-void EchoCanceller::process(std::vector<int16_t>& capture) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    if (echo_buffer_.empty()) {
-        return; // Echo data yok
+void EchoCanceller::process_block() {
+    // 1) Uzak uç bloğu: eksik kalan kısım sessizlik sayılır
+    const size_t got = far_queue_.read(far_block_.data(), BLOCK_SIZE);
+    std::fill(far_block_.data() + got, far_block_.data() + BLOCK_SIZE, int16_t{0});
+
+    float* far_time = far_time_.data();
+    std::memmove(far_time, far_time + BLOCK_SIZE, BLOCK_SIZE * sizeof(float));
+    float far_energy = 0.0f;
+    for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+        const float x = static_cast<float>(far_block_[i]) * SAMPLE_SCALE;
+        far_time[BLOCK_SIZE + i] = x;
+        far_energy += x * x;
     }
-    
-    // Capture RMS hesapla
-    float capture_rms = 0.0f;
-    for (const auto& sample : capture) {
-        capture_rms += static_cast<float>(sample * sample);
+
+    far_head_ = (far_head_ + partitions_ - 1) % partitions_;
+    float* x_re = far_re_.data() + far_head_ * BINS;
+    float* x_im = far_im_.data() + far_head_ * BINS;
+    fft_.forward(far_time, x_re, x_im);
+
+    float* power = far_power_.data();
+    for (size_t k = 0; k < BINS; ++k) {
+        const float p = x_re[k] * x_re[k] + x_im[k] * x_im[k];
+        power[k] = POWER_SMOOTHING * power[k] + (1.0f - POWER_SMOOTHING) * p;
     }
-    capture_rms = std::sqrt(capture_rms / capture.size());
-    
-    // Echo var mı kontrol et
-    if (capture_rms < adaptive_threshold_ * 0.5f) {
-        // Çok düşük ses - muhtemelen sadece echo
-        for (auto& sample : capture) {
-            sample = static_cast<int16_t>(sample * 0.1f); // %90 azalt
-        }
+
+    // 2) Yankı tahmini ve hata: e = d - y
+    filter_echo();
+
+    const float* echo = time_buffer_.data() + BLOCK_SIZE;
+    float* error = error_.data();
+    float near_energy = 0.0f;
+    float error_energy = 0.0f;
+    std::fill(error, error + BLOCK_SIZE, 0.0f);
+    for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+        const float d = near_block_[i];
+        const float e = d - echo[i];
+        error[BLOCK_SIZE + i] = e;
+        near_energy += d * d;
+        error_energy += e * e;
+        const float scaled = std::clamp(e * 32768.0f, -32768.0f, 32767.0f);
+        out_block_[i] = static_cast<int16_t>(std::lrint(scaled));
+    }
+
+    // 3) Uyarlama: uzak uç sessizse veya yakınsamış filtrede hata yankıyla açıklanamıyorsa
+    //    (çift konuşma) katsayılar dondurulur. Uzun süre donmuşsa yankı yolu değişmiş sayılır.
+    if (far_energy < MIN_FAR_ENERGY * BLOCK_SIZE) {
+        return;
+    }
+
+    const bool converged = erle_ > CONVERGED_ERLE;
+    const bool double_talk = converged && error_energy * erle_ > DOUBLE_TALK_RATIO * near_energy;
+    if (double_talk && frozen_blocks_ < MAX_FROZEN_BLOCKS) {
+        ++frozen_blocks_;
         return;
     }
-    
-    size_t n = std::min(capture.size(), echo_buffer_.size());
-    
-    for (size_t i = 0; i < n; ++i) {
-        float capture_f = static_cast<float>(capture[i]);
-        float echo_f = static_cast<float>(echo_buffer_[i]);
-        
-        // Agresif echo cancellation
-        float suppressed = capture_f - (echo_f * echo_suppression_factor_);
-        
-        // Aşırı suppression önle
-        if (std::abs(capture_f) > std::abs(echo_f) * 1.5f) {
-            // Gerçek konuşma var - daha az suppression
-            suppressed = capture_f - (echo_f * 0.3f);
+    if (frozen_blocks_ >= MAX_FROZEN_BLOCKS) {
+        erle_ = 1.0f;
+    }
+    frozen_blocks_ = 0;
+
+    const float block_erle = (near_energy + 1e-9f) / (error_energy + 1e-9f);
+    erle_ = 0.95f * erle_ + 0.05f * std::min(block_erle, 1000.0f);
+
+    // Adım bölüm sayısına bölünür: tüm bölümlerin toplam güncellemesi NLMS sınırında kalır
+    adapt(STEP_SIZE / static_cast<float>(partitions_));
+    constrain_partition(constrain_index_);
+    constrain_index_ = (constrain_index_ + 1) % partitions_;
+}
+
+// Y = sum_p W_p * X_{m-p}; zaman alanında ikinci yarı (son blok) doğrusal konvolüsyondur.
+void EchoCanceller::filter_echo() {
+    float* y_re = spectrum_re_.data();
+    float* y_im = spectrum_im_.data();
+    std::fill(y_re, y_re + BINS, 0.0f);
+    std::fill(y_im, y_im + BINS, 0.0f);
+
+    for (size_t p = 0; p < partitions_; ++p) {
+        const size_t slot = (far_head_ + p) % partitions_;
+        const float* x_re = far_re_.data() + slot * BINS;
+        const float* x_im = far_im_.data() + slot * BINS;
+        const float* w_re = weight_re_.data() + p * BINS;
+        const float* w_im = weight_im_.data() + p * BINS;
+        for (size_t k = 0; k < BINS; ++k) {
+            y_re[k] += w_re[k] * x_re[k] - w_im[k] * x_im[k];
+            y_im[k] += w_re[k] * x_im[k] + w_im[k] * x_re[k];
         }
-        
-        // Clamp ve set
-        int val = static_cast<int>(suppressed);
-        val = std::clamp(val, -32768, 32767);
-        capture[i] = static_cast<int16_t>(val);
     }
-    
-    // İşlenen echo data'yı temizle
-    if (n > 0) {
-        echo_buffer_.erase(echo_buffer_.begin(), echo_buffer_.begin() + n);
+
+    fft_.inverse(y_re, y_im, time_buffer_.data());
+}
+
+// W_p += mu / (P_k + delta) * conj(X_{m-p}) * E
+void EchoCanceller::adapt(float step_scale) {
+    float* e_re = spectrum_re_.data();
+    float* e_im = spectrum_im_.data();
+    fft_.forward(error_.data(), e_re, e_im);
+
+    const float* power = far_power_.data();
+    for (size_t k = 0; k < BINS; ++k) {
+        const float step = step_scale / (power[k] + REGULARIZATION);
+        e_re[k] *= step;
+        e_im[k] *= step;
+    }
+
+    for (size_t p = 0; p < partitions_; ++p) {
+        const size_t slot = (far_head_ + p) % partitions_;
+        const float* x_re = far_re_.data() + slot * BINS;
+        const float* x_im = far_im_.data() + slot * BINS;
+        float* w_re = weight_re_.data() + p * BINS;
+        float* w_im = weight_im_.data() + p * BINS;
+        for (size_t k = 0; k < BINS; ++k) {
+            w_re[k] += x_re[k] * e_re[k] + x_im[k] * e_im[k];
+            w_im[k] += x_re[k] * e_im[k] - x_im[k] * e_re[k];
+        }
     }
 }
+
+// Dairesel konvolüsyon artığını önlemek için katsayının zaman alanı ikinci yarısı sıfırlanır.
+void EchoCanceller::constrain_partition(size_t partition) {
+    float* w_re = weight_re_.data() + partition * BINS;
+    float* w_im = weight_im_.data() + partition * BINS;
+    float* time = time_buffer_.data();
+    fft_.inverse(w_re, w_im, time);
+    std::fill(time + BLOCK_SIZE, time + FFT_SIZE, 0.0f);
+    fft_.forward(time, w_re, w_im);
+}
 }
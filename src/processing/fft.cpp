@@ -0,0 +1,129 @@
+#include "processing/fft.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace processing {
+namespace {
+    constexpr double PI = 3.14159265358979323846;
+}
+
+RealFft::RealFft(size_t size)
+    : size_(size),
+      half_(size / 2),
+      bit_reverse_(size / 2),
+      twiddle_re_(size / 4 > 0 ? size / 4 : 1),
+      twiddle_im_(size / 4 > 0 ? size / 4 : 1),
+      split_re_(size / 2 + 1),
+      split_im_(size / 2 + 1),
+      work_re_(size / 2),
+      work_im_(size / 2) {
+    if (size_ < 4 || (size_ & (size_ - 1)) != 0) {
+        throw std::invalid_argument("FFT boyutu 4 veya daha büyük ikinin kuvveti olmalı");
+    }
+
+    size_t bits = 0;
+    while ((size_t{1} << bits) < half_) {
+        ++bits;
+    }
+    for (size_t i = 0; i < half_; ++i) {
+        uint32_t reversed = 0;
+        for (size_t b = 0; b < bits; ++b) {
+            if (i & (size_t{1} << b)) {
+                reversed |= 1u << (bits - 1 - b);
+            }
+        }
+        bit_reverse_[i] = reversed;
+    }
+
+    for (size_t k = 0; k < half_ / 2; ++k) {
+        const double angle = -2.0 * PI * static_cast<double>(k) / static_cast<double>(half_);
+        twiddle_re_[k] = static_cast<float>(std::cos(angle));
+        twiddle_im_[k] = static_cast<float>(std::sin(angle));
+    }
+    for (size_t k = 0; k <= half_; ++k) {
+        const double angle = -2.0 * PI * static_cast<double>(k) / static_cast<double>(size_);
+        split_re_[k] = static_cast<float>(std::cos(angle));
+        split_im_[k] = static_cast<float>(std::sin(angle));
+    }
+}
+
+// Yerinde iteratif radix-2 (ölçeklemesiz). inverse=true eşlenik twiddle kullanır.
+void RealFft::complex_fft(float* re, float* im, bool inverse) const {
+    for (size_t i = 0; i < half_; ++i) {
+        const size_t j = bit_reverse_[i];
+        if (j > i) {
+            std::swap(re[i], re[j]);
+            std::swap(im[i], im[j]);
+        }
+    }
+
+    const float sign = inverse ? -1.0f : 1.0f;
+    for (size_t len = 2; len <= half_; len <<= 1) {
+        const size_t half_len = len / 2;
+        const size_t stride = half_ / len;
+        for (size_t start = 0; start < half_; start += len) {
+            for (size_t k = 0; k < half_len; ++k) {
+                const float w_re = twiddle_re_[k * stride];
+                const float w_im = sign * twiddle_im_[k * stride];
+                const size_t a = start + k;
+                const size_t b = a + half_len;
+                const float t_re = re[b] * w_re - im[b] * w_im;
+                const float t_im = re[b] * w_im + im[b] * w_re;
+                re[b] = re[a] - t_re;
+                im[b] = im[a] - t_im;
+                re[a] += t_re;
+                im[a] += t_im;
+            }
+        }
+    }
+}
+
+void RealFft::forward(const float* input, float* out_re, float* out_im) {
+    float* z_re = work_re_.data();
+    float* z_im = work_im_.data();
+    // Çift/tek örnekler tek bir N/2 noktalı kompleks dizi olarak paketlenir
+    for (size_t n = 0; n < half_; ++n) {
+        z_re[n] = input[2 * n];
+        z_im[n] = input[2 * n + 1];
+    }
+    complex_fft(z_re, z_im, false);
+
+    // X[k] = (Z[k] + Z*[M-k]) / 2 - i/2 * W^k * (Z[k] - Z*[M-k])
+    for (size_t k = 0; k <= half_; ++k) {
+        const size_t a = k % half_;
+        const size_t b = (half_ - k) % half_;
+        const float even_re = 0.5f * (z_re[a] + z_re[b]);
+        const float even_im = 0.5f * (z_im[a] - z_im[b]);
+        const float odd_re = 0.5f * (z_im[a] + z_im[b]);
+        const float odd_im = -0.5f * (z_re[a] - z_re[b]);
+        out_re[k] = even_re + split_re_[k] * odd_re - split_im_[k] * odd_im;
+        out_im[k] = even_im + split_re_[k] * odd_im + split_im_[k] * odd_re;
+    }
+}
+
+void RealFft::inverse(const float* in_re, const float* in_im, float* output) {
+    float* z_re = work_re_.data();
+    float* z_im = work_im_.data();
+    // forward paketlemesinin tersi: çift ve tek spektrumlar ayrılıp tek diziye birleştirilir
+    for (size_t k = 0; k < half_; ++k) {
+        const size_t b = half_ - k;
+        const float even_re = 0.5f * (in_re[k] + in_re[b]);
+        const float even_im = 0.5f * (in_im[k] - in_im[b]);
+        const float diff_re = 0.5f * (in_re[k] - in_re[b]);
+        const float diff_im = 0.5f * (in_im[k] + in_im[b]);
+        // odd = diff * conj(W^k)
+        const float odd_re = diff_re * split_re_[k] + diff_im * split_im_[k];
+        const float odd_im = diff_im * split_re_[k] - diff_re * split_im_[k];
+        // Z[k] = even + i * odd
+        z_re[k] = even_re - odd_im;
+        z_im[k] = even_im + odd_re;
+    }
+    complex_fft(z_re, z_im, true);
+
+    const float scale = 1.0f / static_cast<float>(half_);
+    for (size_t n = 0; n < half_; ++n) {
+        output[2 * n] = z_re[n] * scale;
+        output[2 * n + 1] = z_im[n] * scale;
+    }
+}
+}
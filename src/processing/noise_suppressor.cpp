@@ -1,11 +1,13 @@
 #include "processing/noise_suppressor.hpp"
+#include "processing/dsp_kernels.hpp"
 #include <cmath>
 #include <algorithm>
 #include <iostream>
 
 namespace processing {
 NoiseSuppressor::NoiseSuppressor(int16_t initial_threshold, float alpha)
-    : threshold_(static_cast<float>(initial_threshold * 3)), // 3x daha agresif
+    : engine_(Engine::Gate),
+      threshold_(static_cast<float>(initial_threshold * 3)), // 3x daha agresif
       noise_level_(static_cast<float>(initial_threshold)),
       alpha_(alpha),
       silence_counter_(0),
@@ -15,14 +17,44 @@ NoiseSuppressor::NoiseSuppressor(int16_t initial_threshold, float alpha)
     std::cout << "Agresif Noise Suppressor başlatıldı - Threshold: " << threshold_ << std::endl;
 }
 
+NoiseSuppressor::NoiseSuppressor(Engine engine)
+    : engine_(engine),
+      threshold_(1500.0f),
+      noise_level_(500.0f),
+      alpha_(0.95f),
+      silence_counter_(0),
+      noise_gate_threshold_(1000.0f),
+      noise_reduction_factor_(0.1f) {
+    if (engine_ == Engine::Spectral) {
+        spectral_ = std::make_unique<SpectralNoiseSuppressor>();
+    } else {
+        std::cout << "Agresif Noise Suppressor başlatıldı - Threshold: " << threshold_ << std::endl;
+    }
+}
+
 void NoiseSuppressor::process(std::vector<int16_t>& samples) {
+    if (engine_ == Engine::Spectral) {
+        spectral_->process(samples);
+        return;
+    }
+    if (samples.empty()) return;
     // RMS (Root Mean Square) hesapla - daha doğru ses seviyesi
-    float rms = 0.0f;
-    for (const auto& sample : samples) {
-        rms += static_cast<float>(sample * sample);
+    const uint64_t energy = sum_of_squares(samples.data(), samples.size());
+    process_gate(samples.data(), samples.size(), std::sqrt(static_cast<float>(energy) / samples.size()));
+}
+
+void NoiseSuppressor::process(AudioFrame& frame) {
+    if (frame.empty()) return;
+    if (engine_ == Engine::Spectral) {
+        spectral_->process(frame.mutable_data(), frame.size());
+        return;
     }
-    rms = std::sqrt(rms / samples.size());
-    
+    // Kapı yalnızca kendi hesaplamadığı RMS'i okur; yazmadan önce önbellekten alınır
+    const float rms = frame.rms();
+    process_gate(frame.mutable_data(), frame.size(), rms);
+}
+
+void NoiseSuppressor::process_gate(int16_t* samples, size_t count, float rms) {
     // Adaptif noise level güncelle
     if (rms < noise_gate_threshold_) {
         // Sessizlik/gürültü bölgesi
@@ -37,7 +69,8 @@ void NoiseSuppressor::process(std::vector<int16_t>& samples) {
     float dynamic_threshold = std::max(noise_level_ * 2.5f, noise_gate_threshold_);
     
     // Agresif noise suppression uygula
-    for (auto& sample : samples) {
+    for (size_t i = 0; i < count; ++i) {
+        int16_t& sample = samples[i];
         float abs_sample = std::abs(sample);
         
         if (abs_sample < dynamic_threshold) {
@@ -0,0 +1,22 @@
+#include "processing/pipeline_stages.hpp"
+
+namespace processing {
+    EchoCancellerStage::EchoCancellerStage() : EchoCancellerStage(Config{}) {}
+
+    EchoCancellerStage::EchoCancellerStage(const Config& config)
+        : canceller_(config.tail_length_ms, config.sample_rate) {}
+
+    NoiseSuppressorStage::NoiseSuppressorStage() : NoiseSuppressorStage(Config{}) {}
+
+    NoiseSuppressorStage::NoiseSuppressorStage(const Config& config) : suppressor_(config.engine) {}
+
+    VoiceActivityStage::VoiceActivityStage() : VoiceActivityStage(Config{}) {}
+
+    VoiceActivityStage::VoiceActivityStage(const Config& config)
+        : detector_(config.energy_threshold, config.zero_crossing_threshold,
+                    config.min_speech_frames, config.min_silence_frames) {}
+
+    GainStage::GainStage() : GainStage(Config{}) {}
+
+    GainStage::GainStage(const Config& config) : controller_(config) {}
+}
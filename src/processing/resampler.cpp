@@ -0,0 +1,101 @@
+#include "processing/resampler.hpp"
+#include "processing/dsp_kernels.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace processing {
+    namespace {
+        constexpr double CUTOFF = 0.92;        // Nyquist'e göre geçirme bandı (~22 kHz @ 48 kHz)
+        constexpr double KAISER_BETA = 8.0;    // ~80 dB durdurma bandı
+        constexpr size_t INITIAL_BLOCK = 4096;
+
+        // Birinci tür değiştirilmiş Bessel I0 (seri açılımı)
+        double bessel_i0(double x) {
+            double sum = 1.0;
+            double term = 1.0;
+            const double half_square = x * x / 4.0;
+            for (int k = 1; k < 50 && term > sum * 1e-12; ++k) {
+                term *= half_square / (static_cast<double>(k) * k);
+                sum += term;
+            }
+            return sum;
+        }
+
+        double windowed_sinc(double distance, double radius) {
+            const double ratio = distance / radius;
+            if (std::fabs(ratio) >= 1.0) { return 0.0; }
+            const double x = M_PI * CUTOFF * distance;
+            const double sinc = (distance == 0.0) ? 1.0 : std::sin(x) / x;
+            return CUTOFF * sinc * bessel_i0(KAISER_BETA * std::sqrt(1.0 - ratio * ratio)) / bessel_i0(KAISER_BETA);
+        }
+    }
+
+    FractionalResampler::FractionalResampler() : coefficients_((PHASES + 1) * TAPS) {
+        // j. katsayı, çıkış zamanından (DELAY - 1 - j + kesir) örnek uzaktaki girişe uygulanır
+        const double radius = static_cast<double>(DELAY + 1);
+        double taps[TAPS];
+        for (size_t phase = 0; phase <= PHASES; ++phase) {
+            const double fraction = static_cast<double>(phase) / PHASES;
+            double sum = 0.0;
+            for (size_t j = 0; j < TAPS; ++j) {
+                taps[j] = windowed_sinc(fraction + static_cast<double>(DELAY - 1) - static_cast<double>(j), radius);
+                sum += taps[j];
+            }
+            // DC kazancı tam 1 (Q15 toplamı 32768): yuvarlama artığı en büyük katsayıya eklenir
+            int16_t* row = coefficients_.data() + phase * TAPS;
+            int32_t quantized_sum = 0;
+            size_t largest = 0;
+            for (size_t j = 0; j < TAPS; ++j) {
+                row[j] = static_cast<int16_t>(std::lrint(taps[j] / sum * 32768.0));
+                quantized_sum += row[j];
+                if (std::abs(row[j]) > std::abs(row[largest])) { largest = j; }
+            }
+            row[largest] = static_cast<int16_t>(std::min(32767, row[largest] + 32768 - quantized_sum));
+        }
+        work_.reserve(TAPS + INITIAL_BLOCK);
+        reset();
+    }
+
+    void FractionalResampler::reset() {
+        work_.assign(TAPS, 0);
+        position_ = -static_cast<double>(DELAY);
+    }
+
+    void FractionalResampler::set_ratio(double ratio) {
+        ratio_ = std::clamp(ratio, 1.0 - MAX_DEVIATION, 1.0 + MAX_DEVIATION);
+        step_ = 1.0 / ratio_;
+    }
+
+    size_t FractionalResampler::process(const int16_t* input, size_t count, int16_t* output) {
+        if (!input || count == 0) { return 0; }
+        work_.resize(TAPS + count);
+        std::memcpy(work_.data() + TAPS, input, count * sizeof(int16_t));
+
+        const auto& kernels = dsp_kernels();
+        const int16_t* base = work_.data() + TAPS - (DELAY - 1);
+        const double last = static_cast<double>(count) - static_cast<double>(DELAY);
+        size_t produced = 0;
+        // Çıkış zamanı t = n + kesir; pencere n - (DELAY - 1) .. n + DELAY girişlerini kapsar
+        while (position_ < last) {
+            const double whole = std::floor(position_);
+            const double phase_position = (position_ - whole) * PHASES;
+            const size_t phase = std::min(static_cast<size_t>(phase_position), PHASES - 1);
+            const double blend = phase_position - static_cast<double>(phase);
+
+            const int16_t* window = base + static_cast<ptrdiff_t>(whole);
+            const int16_t* row = coefficients_.data() + phase * TAPS;
+            const int64_t lower = kernels.dot_product(window, row, TAPS);
+            const int64_t upper = kernels.dot_product(window, row + TAPS, TAPS);
+            const double value = (static_cast<double>(lower) + blend * static_cast<double>(upper - lower)) / 32768.0;
+            output[produced++] = static_cast<int16_t>(std::clamp(std::lrint(value), -32768L, 32767L));
+            position_ += step_;
+        }
+        position_ -= static_cast<double>(count);
+
+        // Sonraki blok için son TAPS giriş örneği geçmiş olarak kalır
+        std::memmove(work_.data(), work_.data() + count, TAPS * sizeof(int16_t));
+        work_.resize(TAPS);
+        return produced;
+    }
+}
@@ -0,0 +1,220 @@
+#include "processing/spectral_noise_suppressor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace processing {
+namespace {
+    constexpr double PI = 3.14159265358979323846;
+    constexpr float NOISE_FLOOR = 1e-3f;   // Sıfıra bölmeyi önler (int16 ölçeğinde güç)
+
+    // |Y|^2 = re^2 + im^2
+    void power_spectrum(const float* re, const float* im, float* out, size_t n) {
+        size_t k = 0;
+#if defined(__SSE2__)
+        for (; k + 4 <= n; k += 4) {
+            const __m128 r = _mm_load_ps(re + k);
+            const __m128 i = _mm_load_ps(im + k);
+            _mm_store_ps(out + k, _mm_add_ps(_mm_mul_ps(r, r), _mm_mul_ps(i, i)));
+        }
+#endif
+        for (; k < n; ++k) {
+            out[k] = re[k] * re[k] + im[k] * im[k];
+        }
+    }
+
+    // Decision-directed Wiener kazancı:
+    //   gamma = |Y|^2 / N,  xi = b * prev + (1 - b) * max(gamma - 1, 0),  G = max(xi / (1 + xi), G_min)
+    //   prev <- G^2 * gamma
+    void wiener_gain(const float* power, const float* noise, float* prev_clean_snr, float* gain,
+                     size_t n, float prior_smoothing, float min_gain) {
+        size_t k = 0;
+#if defined(__SSE2__)
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 beta = _mm_set1_ps(prior_smoothing);
+        const __m128 one_minus_beta = _mm_set1_ps(1.0f - prior_smoothing);
+        const __m128 floor = _mm_set1_ps(min_gain);
+        const __m128 noise_floor = _mm_set1_ps(NOISE_FLOOR);
+        for (; k + 4 <= n; k += 4) {
+            const __m128 gamma = _mm_div_ps(_mm_load_ps(power + k), _mm_max_ps(_mm_load_ps(noise + k), noise_floor));
+            const __m128 instant = _mm_max_ps(_mm_sub_ps(gamma, one), zero);
+            const __m128 xi = _mm_add_ps(_mm_mul_ps(beta, _mm_load_ps(prev_clean_snr + k)),
+                                         _mm_mul_ps(one_minus_beta, instant));
+            const __m128 g = _mm_max_ps(_mm_div_ps(xi, _mm_add_ps(one, xi)), floor);
+            _mm_store_ps(gain + k, g);
+            _mm_store_ps(prev_clean_snr + k, _mm_mul_ps(_mm_mul_ps(g, g), gamma));
+        }
+#endif
+        for (; k < n; ++k) {
+            const float gamma = power[k] / std::max(noise[k], NOISE_FLOOR);
+            const float xi = prior_smoothing * prev_clean_snr[k] + (1.0f - prior_smoothing) * std::max(gamma - 1.0f, 0.0f);
+            const float g = std::max(xi / (1.0f + xi), min_gain);
+            gain[k] = g;
+            prev_clean_snr[k] = g * g * gamma;
+        }
+    }
+
+    void apply_gain(float* re, float* im, const float* gain, size_t n) {
+        size_t k = 0;
+#if defined(__SSE2__)
+        for (; k + 4 <= n; k += 4) {
+            const __m128 g = _mm_load_ps(gain + k);
+            _mm_store_ps(re + k, _mm_mul_ps(_mm_load_ps(re + k), g));
+            _mm_store_ps(im + k, _mm_mul_ps(_mm_load_ps(im + k), g));
+        }
+#endif
+        for (; k < n; ++k) {
+            re[k] *= gain[k];
+            im[k] *= gain[k];
+        }
+    }
+}
+
+SpectralNoiseSuppressor::SpectralNoiseSuppressor() : SpectralNoiseSuppressor(Config{}) {}
+
+SpectralNoiseSuppressor::SpectralNoiseSuppressor(const Config& config)
+    : config_(config),
+      fft_(FFT_SIZE),
+      window_(WINDOW_SIZE),
+      frame_(WINDOW_SIZE),
+      time_buffer_(FFT_SIZE),
+      overlap_(HOP_SIZE),
+      spectrum_re_(BINS),
+      spectrum_im_(BINS),
+      power_(BINS),
+      smoothed_power_(BINS),
+      noise_power_(BINS),
+      current_min_(BINS),
+      subwindow_min_(std::max<size_t>(config.subwindow_count, 1) * BINS),
+      prev_clean_snr_(BINS),
+      gain_(BINS),
+      in_block_(HOP_SIZE),
+      out_ring_(HOP_SIZE * 2) {
+    // Periyodik sqrt-Hann: analiz ve sentez pencerelerinin çarpımı %50 örtüşmede bire toplanır
+    for (size_t i = 0; i < WINDOW_SIZE; ++i) {
+        const double hann = 0.5 - 0.5 * std::cos(2.0 * PI * static_cast<double>(i) / static_cast<double>(WINDOW_SIZE));
+        window_[i] = static_cast<float>(std::sqrt(hann));
+    }
+
+    std::cout << "Spektral Noise Suppressor başlatıldı - Hop: " << HOP_SIZE
+              << ", FFT: " << FFT_SIZE << ", Min kazanç: " << config_.min_gain << std::endl;
+}
+
+void SpectralNoiseSuppressor::process(std::vector<int16_t>& samples) {
+    process(samples.data(), samples.size());
+}
+
+void SpectralNoiseSuppressor::process(int16_t* samples, size_t count) {
+    const size_t ring_size = out_ring_.size();
+    size_t done = 0;
+    while (done < count) {
+        // Girişi hop tamponuna al; tamamlanan her hop çıkış halkasına HOP_SIZE örnek ekler
+        const size_t take = std::min(count - done, HOP_SIZE - block_fill_);
+        for (size_t i = 0; i < take; ++i) {
+            in_block_[block_fill_ + i] = static_cast<float>(samples[done + i]);
+        }
+        block_fill_ += take;
+        if (block_fill_ == HOP_SIZE) {
+            process_hop();
+            block_fill_ = 0;
+        }
+
+        // Hizalı olmayan çerçevede çıkış yetmiyorsa bir kerelik bir hop'a tamamlayan sessizlik
+        // eklenir; out_size_ + block_fill_ sabit kaldığından bir daha eksik kalmaz
+        if (out_size_ < take) {
+            const size_t pad = HOP_SIZE - latency_padding_;
+            out_read_ = (out_read_ + ring_size - pad) % ring_size;
+            for (size_t i = 0; i < pad; ++i) {
+                out_ring_[(out_read_ + i) % ring_size] = 0;
+            }
+            out_size_ += pad;
+            latency_padding_ += pad;
+        }
+        for (size_t i = 0; i < take; ++i) {
+            samples[done + i] = out_ring_[out_read_];
+            out_read_ = (out_read_ + 1) % ring_size;
+        }
+        out_size_ -= take;
+        done += take;
+    }
+}
+
+void SpectralNoiseSuppressor::process_hop() {
+    float* frame = frame_.data();
+    std::memmove(frame, frame + HOP_SIZE, HOP_SIZE * sizeof(float));
+    std::memcpy(frame + HOP_SIZE, in_block_.data(), HOP_SIZE * sizeof(float));
+
+    float* time = time_buffer_.data();
+    for (size_t i = 0; i < WINDOW_SIZE; ++i) {
+        time[i] = frame[i] * window_[i];
+    }
+    std::fill(time + WINDOW_SIZE, time + FFT_SIZE, 0.0f);
+
+    fft_.forward(time, spectrum_re_.data(), spectrum_im_.data());
+    power_spectrum(spectrum_re_.data(), spectrum_im_.data(), power_.data(), BINS);
+    update_noise_estimate();
+    wiener_gain(power_.data(), noise_power_.data(), prev_clean_snr_.data(), gain_.data(),
+                BINS, config_.prior_smoothing, config_.min_gain);
+    apply_gain(spectrum_re_.data(), spectrum_im_.data(), gain_.data(), BINS);
+    fft_.inverse(spectrum_re_.data(), spectrum_im_.data(), time);
+
+    // Overlap-add: önceki sentezin ikinci yarısı + bu sentezin ilk yarısı
+    float* overlap = overlap_.data();
+    const size_t ring_size = out_ring_.size();
+    size_t write = (out_read_ + out_size_) % ring_size;
+    for (size_t i = 0; i < HOP_SIZE; ++i) {
+        const float out = overlap[i] + time[i] * window_[i];
+        overlap[i] = time[HOP_SIZE + i] * window_[HOP_SIZE + i];
+        out_ring_[write] = static_cast<int16_t>(std::lrint(std::clamp(out, -32768.0f, 32767.0f)));
+        write = (write + 1) % ring_size;
+    }
+    out_size_ += HOP_SIZE;
+}
+
+// Minimum istatistik: yumuşatılmış periodogramın son subwindow_count alt penceredeki minimumu
+void SpectralNoiseSuppressor::update_noise_estimate() {
+    const float* power = power_.data();
+    float* smoothed = smoothed_power_.data();
+    float* current_min = current_min_.data();
+    float* noise = noise_power_.data();
+    const size_t subwindows = std::max<size_t>(config_.subwindow_count, 1);
+
+    if (frame_count_ == 0) {
+        std::copy(power, power + BINS, smoothed);
+        std::copy(power, power + BINS, current_min);
+        for (size_t u = 0; u < subwindows; ++u) {
+            std::copy(power, power + BINS, subwindow_min_.data() + u * BINS);
+        }
+    }
+
+    const float a = config_.power_smoothing;
+    for (size_t k = 0; k < BINS; ++k) {
+        smoothed[k] = a * smoothed[k] + (1.0f - a) * power[k];
+        current_min[k] = std::min(current_min[k], smoothed[k]);
+    }
+
+    ++frame_count_;
+    if (frame_count_ % std::max<size_t>(config_.subwindow_frames, 1) == 0) {
+        std::copy(current_min, current_min + BINS, subwindow_min_.data() + subwindow_index_ * BINS);
+        subwindow_index_ = (subwindow_index_ + 1) % subwindows;
+        std::copy(smoothed, smoothed + BINS, current_min);
+    }
+
+    std::copy(current_min, current_min + BINS, noise);
+    for (size_t u = 0; u < subwindows; ++u) {
+        const float* sub = subwindow_min_.data() + u * BINS;
+        for (size_t k = 0; k < BINS; ++k) {
+            noise[k] = std::min(noise[k], sub[k]);
+        }
+    }
+    for (size_t k = 0; k < BINS; ++k) {
+        noise[k] *= config_.noise_bias;
+    }
+}
+}
@@ -0,0 +1,135 @@
+#include "processing/time_scale_modifier.hpp"
+#include "processing/dsp_kernels.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace processing {
+    namespace {
+        // Bu ortalama gücün altındaki blok sessizlik sayılır: periyodiklik aranmaz, en uzun periyot kullanılır
+        constexpr double SILENCE_POWER = 64.0 * 64.0;
+
+        double normalized_correlation(const int16_t* a, const int16_t* b, size_t length) {
+            const auto& kernels = dsp_kernels();
+            const double energy = static_cast<double>(kernels.sum_of_squares(a, length)) *
+                                  static_cast<double>(kernels.sum_of_squares(b, length));
+            if (energy <= 0.0) { return 0.0; }
+            return static_cast<double>(kernels.dot_product(a, b, length)) / std::sqrt(energy);
+        }
+
+        bool is_silence(const int16_t* samples, size_t count) {
+            return static_cast<double>(sum_of_squares(samples, count)) < SILENCE_POWER * static_cast<double>(count);
+        }
+
+        // out[i] = from[i] -> to[i] doğrusal çapraz geçiş (i = 0'da tamamen from)
+        void crossfade(const int16_t* from, const int16_t* to, size_t length, int16_t* out) {
+            const float step = 1.0f / static_cast<float>(length);
+            for (size_t i = 0; i < length; ++i) {
+                const float weight = (static_cast<float>(i) + 0.5f) * step;
+                const float value = static_cast<float>(from[i]) + weight * static_cast<float>(to[i] - from[i]);
+                out[i] = static_cast<int16_t>(std::lrintf(value));
+            }
+        }
+    }
+
+    TimeScaleModifier::TimeScaleModifier() : history_(MAX_PERIOD, 0) {}
+
+    void TimeScaleModifier::reset() {
+        history_size_ = 0;
+    }
+
+    size_t TimeScaleModifier::best_accelerate_lag(const int16_t* input, size_t count, float& correlation) const {
+        // x[0..L) ile x[T..T+L) karşılaştırılır; L = min(T, count - T)
+        if (count < MIN_PERIOD + MIN_OVERLAP) { return 0; }
+        const size_t max_lag = std::min(MAX_PERIOD, count - MIN_OVERLAP);
+        if (is_silence(input, count)) {
+            correlation = 1.0f;
+            return max_lag;
+        }
+        size_t best_lag = 0;
+        double best = -1.0;
+        for (size_t lag = MIN_PERIOD; lag <= max_lag; ++lag) {
+            const double value = normalized_correlation(input, input + lag, std::min(lag, count - lag));
+            if (value > best) {
+                best = value;
+                best_lag = lag;
+            }
+        }
+        correlation = static_cast<float>(best);
+        return best_lag;
+    }
+
+    size_t TimeScaleModifier::best_expand_lag(const int16_t* input, size_t count, float& correlation) const {
+        // Önceki çıkışın son T örneği ile bloğun ilk T örneği karşılaştırılır
+        const size_t max_lag = std::min({MAX_PERIOD, count, history_size_});
+        if (max_lag < MIN_PERIOD) { return 0; }
+        const int16_t* history_end = history_.data() + history_.size();
+        if (is_silence(input, count)) {
+            correlation = 1.0f;
+            return max_lag;
+        }
+        size_t best_lag = 0;
+        double best = -1.0;
+        for (size_t lag = MIN_PERIOD; lag <= max_lag; ++lag) {
+            const double value = normalized_correlation(history_end - lag, input, lag);
+            if (value > best) {
+                best = value;
+                best_lag = lag;
+            }
+        }
+        correlation = static_cast<float>(best);
+        return best_lag;
+    }
+
+    size_t TimeScaleModifier::process(const int16_t* input, size_t count, Mode mode, int16_t* output) {
+        if (!input || count == 0) { return 0; }
+        size_t produced = 0;
+        float correlation = 0.0f;
+
+        if (mode == Mode::Accelerate) {
+            const size_t lag = best_accelerate_lag(input, count, correlation);
+            if (lag > 0 && correlation >= MIN_CORRELATION) {
+                // Periyot çıkarma: x[0..L) -> x[T..T+L) geçişi, ardından x[T+L..)
+                const size_t overlap = std::min(lag, count - lag);
+                crossfade(input, input + lag, overlap, output);
+                std::memcpy(output + overlap, input + lag + overlap, (count - lag - overlap) * sizeof(int16_t));
+                produced = count - lag;
+                stats_.accelerated++;
+                stats_.removed_samples += lag;
+            } else {
+                stats_.rejected++;
+            }
+        } else if (mode == Mode::Expand) {
+            const size_t lag = best_expand_lag(input, count, correlation);
+            if (lag > 0 && correlation >= MIN_CORRELATION) {
+                // Periyot ekleme: x[0..T) -> önceki çıkışın son periyodu geçişi, ardından x'in tamamı.
+                // Başta x[0] önceki çıkışın devamı, sonda son periyot x[0]'ın öncülüdür.
+                crossfade(input, history_.data() + history_.size() - lag, lag, output);
+                std::memcpy(output + lag, input, count * sizeof(int16_t));
+                produced = count + lag;
+                stats_.expanded++;
+                stats_.inserted_samples += lag;
+            } else {
+                stats_.rejected++;
+            }
+        }
+
+        if (produced == 0) {
+            std::memcpy(output, input, count * sizeof(int16_t));
+            produced = count;
+        }
+        remember(output, produced);
+        return produced;
+    }
+
+    void TimeScaleModifier::remember(const int16_t* output, size_t count) {
+        const size_t capacity = history_.size();
+        if (count >= capacity) {
+            std::memcpy(history_.data(), output + count - capacity, capacity * sizeof(int16_t));
+        } else {
+            std::memmove(history_.data(), history_.data() + count, (capacity - count) * sizeof(int16_t));
+            std::memcpy(history_.data() + capacity - count, output, count * sizeof(int16_t));
+        }
+        history_size_ = std::min(capacity, history_size_ + count);
+    }
+}
@@ -1,4 +1,5 @@
 #include "processing/voice_activity_detector.hpp"
+#include "processing/dsp_kernels.hpp"
 #include <cmath>
 #include <algorithm>
 #include <iostream>
@@ -29,25 +30,15 @@ VoiceActivityDetector::VoiceActivityDetector(
 }
 
 float VoiceActivityDetector::calculate_energy(const std::vector<int16_t>& samples) {
-    float energy = 0.0f;
-    for (const auto& sample : samples) {
-        energy += static_cast<float>(sample * sample);
-    }
-    return energy / samples.size(); // Normalize
+    const uint64_t energy = sum_of_squares(samples.data(), samples.size());
+    return static_cast<float>(energy) / samples.size(); // Normalize
 }
 
 float VoiceActivityDetector::calculate_zero_crossing_rate(const std::vector<int16_t>& samples) {
     if (samples.size() < 2) return 0.0f;
     
-    int zero_crossings = 0;
-    for (size_t i = 1; i < samples.size(); ++i) {
-        if ((samples[i-1] >= 0 && samples[i] < 0) || 
-            (samples[i-1] < 0 && samples[i] >= 0)) {
-            zero_crossings++;
-        }
-    }
-    
-    return static_cast<float>(zero_crossings) / (samples.size() - 1);
+    const size_t crossings = zero_crossings(samples.data(), samples.size());
+    return static_cast<float>(crossings) / (samples.size() - 1);
 }
 
 bool VoiceActivityDetector::detect_voice(const std::vector<int16_t>& samples) {
@@ -56,9 +47,17 @@ bool VoiceActivityDetector::detect_voice(const std::vector<int16_t>& samples) {
     }
     
     // Energy ve zero crossing rate hesapla
-    float current_energy = calculate_energy(samples);
-    float zcr = calculate_zero_crossing_rate(samples);
-    
+    return update(calculate_energy(samples), calculate_zero_crossing_rate(samples));
+}
+
+bool VoiceActivityDetector::detect_voice(const AudioFrame& frame) {
+    if (frame.empty()) {
+        return false;
+    }
+    return update(frame.mean_energy(), frame.zero_crossing_rate());
+}
+
+bool VoiceActivityDetector::update(float current_energy, float zcr) {
     // Energy history güncelle
     energy_history_[history_index_] = current_energy;
     history_index_ = (history_index_ + 1) % 10;
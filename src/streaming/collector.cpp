@@ -1,97 +1,334 @@
 #include "streaming/collector.hpp"
-#include <iostream>
 #include <algorithm>
-#include <map>
+#include <array>
+#include <cmath>
+#include <mutex>
 
 namespace streaming {
 
 class Collector::Impl {
 public:
-    struct PacketBuffer {
-        std::map<uint32_t, core::Packet> packets;
-        uint32_t expected_sequence = 0;
-        bool is_collecting = false;
-        size_t total_data_size = 0;
-        
-        void reset() {
-            packets.clear();
-            expected_sequence = 0;
-            is_collecting = false;
-            total_data_size = 0;
-        }
+    struct Slot {
+        uint32_t sequence = 0;
+        uint32_t timestamp = 0;
+        uint8_t payload_type = core::PAYLOAD_TYPE_OPUS;
+        bool marker = false;
+        bool occupied = false;
+        std::vector<uint8_t> data;
     };
-    
-    PacketBuffer buffer_;
-    static constexpr size_t MAX_PACKET_BUFFER = 100;
-    static constexpr uint32_t MAX_SEQUENCE_GAP = 10;
-    
-    void collect(const core::Packet& packet, const OnDataCollected& callback) {
-        if (!callback) return;
-        
-        // İlk paket geldiğinde buffer'ı başlat
-        if (!buffer_.is_collecting) {
-            buffer_.expected_sequence = packet.sequence_number;
-            buffer_.is_collecting = true;
+
+    explicit Impl(const Config& config) : config_(config) {
+        // Slot verileri bir kez ayrılır, paket başına allocation yapılmaz
+        for (auto& slot : slots_) {
+            slot.data.reserve(MAX_PAYLOAD_SIZE);
+        }
+    }
+
+    void collect(const core::PacketView& packet, const OnDataCollected& callback, Clock::time_point now) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // İlk paket geldiğinde ya da gönderen değiştiğinde (SSRC) buffer'ı başlat
+        if (is_collecting_ && packet.ssrc != ssrc_) {
+            stats_.resets++;
+            clear_slots();
+            is_collecting_ = false;
+        }
+        if (!is_collecting_) {
+            ssrc_ = packet.ssrc;
+            start_stream(packet.sequence_number);
+        }
+
+        // 16 bit hat sequence'ını beklenen değere göre 32 bite genişlet
+        const uint16_t wire_sequence = static_cast<uint16_t>(packet.sequence_number);
+        const uint32_t sequence = next_sequence_ +
+            static_cast<int16_t>(static_cast<uint16_t>(wire_sequence - static_cast<uint16_t>(next_sequence_)));
+
+        const int32_t offset = static_cast<int32_t>(sequence - next_sequence_);
+        if (offset >= static_cast<int32_t>(SLOT_COUNT) || offset < -static_cast<int32_t>(SLOT_COUNT)) {
+            // Slot penceresinin dışında: akış yeniden başladı ya da uzun kesinti
+            stats_.resets++;
+            clear_slots();
+            start_stream(sequence);
         }
-        
-        // Paket buffer'a ekle
-        buffer_.packets[packet.sequence_number] = packet;
-        buffer_.total_data_size += packet.data.size();
-        
-        // Buffer overflow kontrolü
-        if (buffer_.packets.size() > MAX_PACKET_BUFFER) {
-            std::cout << "UYARI: Packet buffer overflow, buffer temizleniyor." << std::endl;
-            buffer_.reset();
+
+        update_jitter(packet.timestamp, now);
+
+        if (static_cast<int32_t>(sequence - next_sequence_) < 0) {
+            // Deadline'ı geçmiş ya da zaten gizlenmiş çerçeve
+            stats_.late++;
+            return;
+        }
+
+        Slot& slot = slots_[sequence % SLOT_COUNT];
+        if (slot.occupied && slot.sequence == sequence) {
+            stats_.duplicates++;
             return;
         }
-        
-        // Sıralı paketleri işle
-        process_sequential_packets(callback);
-        
-        // Eski paketleri temizle
-        cleanup_old_packets();
-    }
-    
+        slot.sequence = sequence;
+        slot.occupied = true;
+        slot.timestamp = packet.timestamp;
+        slot.payload_type = packet.payload_type;
+        slot.marker = packet.marker;
+        slot.data.assign(packet.payload, packet.payload + std::min(packet.payload_size, MAX_PAYLOAD_SIZE));
+        stats_.received++;
+
+        if (static_cast<int32_t>(sequence - highest_sequence_) > 0) {
+            highest_sequence_ = sequence;
+        }
+
+        drain(now, callback);
+    }
+
+    void poll(const OnDataCollected& callback, Clock::time_point now) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!is_collecting_) { return; }
+        drain(now, callback);
+    }
+
+    void set_loss_callback(OnDataLost callback) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        on_data_lost_ = std::move(callback);
+    }
+
+    void set_silence_callback(OnSilence callback) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        on_silence_ = std::move(callback);
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        clear_slots();
+        is_collecting_ = false;
+        jitter_us_ = 0.0;
+    }
+
+    Stats get_stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats stats = stats_;
+        stats.jitter_ms = jitter_us_ / 1000.0;
+        stats.target_delay_ms = target_delay_us() / 1000.0;
+        stats.ssrc = ssrc_;
+        stats.highest_sequence = highest_sequence_;
+        return stats;
+    }
+
 private:
-    void process_sequential_packets(const OnDataCollected& callback) {
-        while (buffer_.packets.find(buffer_.expected_sequence) != buffer_.packets.end()) {
-            const auto& packet = buffer_.packets[buffer_.expected_sequence];
-            
-            // Tek paket halinde data'yı gönder (basit approach)
-            if (!packet.data.empty()) {
-                callback(packet.data);
+    void start_stream(uint32_t sequence) {
+        next_sequence_ = sequence;
+        highest_sequence_ = sequence;
+        has_released_ = false;
+        has_origin_ = false;
+        has_transit_ = false;
+        in_silence_ = false;
+        is_collecting_ = true;
+    }
+
+    void clear_slots() {
+        for (auto& slot : slots_) {
+            slot.occupied = false;
+            slot.data.clear();
+        }
+    }
+
+    // Paketin medya zamanı (mikrosaniye), akışın ilk timestamp'ine göre
+    double media_time_us(uint32_t timestamp) const {
+        return static_cast<double>(static_cast<int32_t>(timestamp - timestamp_origin_)) * 1e6 /
+               static_cast<double>(config_.clock_rate);
+    }
+
+    double arrival_us(Clock::time_point t) const {
+        return std::chrono::duration<double, std::micro>(t - time_origin_).count();
+    }
+
+    // RFC 3550 varış jitter'ı: J += (|D| - J) / 16
+    void update_jitter(uint32_t timestamp, Clock::time_point now) {
+        if (!has_origin_) {
+            timestamp_origin_ = timestamp;
+            time_origin_ = now;
+            has_origin_ = true;
+        }
+        const double transit = arrival_us(now) - media_time_us(timestamp);
+        if (has_transit_ && transit - last_transit_ > static_cast<double>(config_.max_delay.count())) {
+            // Ani büyük gecikme sıçraması (gönderen yeniden başladı vb.): tabanı yeniden hizala
+            base_transit_ = transit;
+        } else if (has_transit_) {
+            const double d = std::abs(transit - last_transit_);
+            jitter_us_ += (d - jitter_us_) / 16.0;
+            // Taban gecikme: minimumu hemen izler, artışları yavaşça takip eder (saat kayması)
+            if (transit < base_transit_) {
+                base_transit_ = transit;
+            } else {
+                base_transit_ += (transit - base_transit_) / 256.0;
+            }
+        } else {
+            base_transit_ = transit;
+            has_transit_ = true;
+        }
+        last_transit_ = transit;
+    }
+
+    double target_delay_us() const {
+        const double target = config_.jitter_multiplier * jitter_us_;
+        return std::clamp(target,
+                          static_cast<double>(config_.min_delay.count()),
+                          static_cast<double>(config_.max_delay.count()));
+    }
+
+    // Eksik paketin timestamp'i bilinmez; son çıkarılan paketten sonra ilk bekleyen
+    // paketin timestamp'ine kadar eşit aralıklı kabul edilerek tahmin edilir.
+    uint32_t expected_timestamp(uint32_t sequence) const {
+        for (uint32_t s = sequence + 1; static_cast<int32_t>(highest_sequence_ - s) >= 0; ++s) {
+            const Slot& slot = slots_[s % SLOT_COUNT];
+            if (slot.occupied && slot.sequence == s) {
+                if (!has_released_) { return slot.timestamp; }
+                const uint32_t steps = s - last_released_sequence_;
+                const uint32_t span = slot.timestamp - last_released_timestamp_;
+                return last_released_timestamp_ + static_cast<uint32_t>(
+                    static_cast<uint64_t>(span) * (sequence - last_released_sequence_) / steps);
             }
-            
-            // İşlenen paketi buffer'dan kaldır
-            buffer_.packets.erase(buffer_.expected_sequence);
-            buffer_.expected_sequence++;
         }
+        return last_released_timestamp_;
     }
-    
-    void cleanup_old_packets() {
-        // Çok eski paketleri temizle (sequence gap çok büyükse)
-        auto it = buffer_.packets.begin();
-        while (it != buffer_.packets.end()) {
-            if (it->first < buffer_.expected_sequence - MAX_SEQUENCE_GAP) {
-                std::cout << "UYARI: Eski paket temizleniyor: " << it->first << std::endl;
-                it = buffer_.packets.erase(it);
+
+    // Sessizlikteyken boşluktan sonraki ilk paket yeni SID ya da konuşma başlangıcıysa (marker)
+    // aradaki paketler de sessizliğe aittir: gizleme yerine konfor gürültüsü sürer.
+    bool gap_in_silence(uint32_t sequence) const {
+        if (!in_silence_) { return false; }
+        for (uint32_t s = sequence + 1; static_cast<int32_t>(highest_sequence_ - s) >= 0; ++s) {
+            const Slot& slot = slots_[s % SLOT_COUNT];
+            if (slot.occupied && slot.sequence == s) {
+                return slot.payload_type == core::PAYLOAD_TYPE_CN || slot.marker;
+            }
+        }
+        return false;
+    }
+
+    bool deadline_passed(uint32_t sequence, Clock::time_point now) const {
+        const double deadline = media_time_us(expected_timestamp(sequence)) + base_transit_ + target_delay_us();
+        return arrival_us(now) >= deadline;
+    }
+
+    // Sıradaki paketleri hemen çıkarır; eksik paket için deadline dolduysa gizler
+    void drain(Clock::time_point now, const OnDataCollected& callback) {
+        uint32_t conceal_run = 0;
+        while (static_cast<int32_t>(highest_sequence_ - next_sequence_) >= 0) {
+            Slot& slot = slots_[next_sequence_ % SLOT_COUNT];
+            if (slot.occupied && slot.sequence == next_sequence_) {
+                if (slot.payload_type == core::PAYLOAD_TYPE_CN) {
+                    in_silence_ = true;
+                    stats_.silence_updates++;
+                    if (on_silence_) {
+                        on_silence_(slot.data);
+                    }
+                } else {
+                    in_silence_ = false;
+                    if (!slot.data.empty() && callback) {
+                        callback(slot.data);
+                    }
+                }
+                slot.occupied = false;
+                has_released_ = true;
+                last_released_sequence_ = next_sequence_;
+                last_released_timestamp_ = slot.timestamp;
+                stats_.released++;
+                next_sequence_++;
+                conceal_run = 0;
+                continue;
+            }
+
+            if (!deadline_passed(next_sequence_, now)) {
+                break;
+            }
+
+            if (gap_in_silence(next_sequence_)) {
+                stats_.silence_gaps++;
+            } else if (conceal_run < config_.max_conceal_run) {
+                const Slot& next = slots_[(next_sequence_ + 1) % SLOT_COUNT];
+                // SID'in içinde FEC yoktur; yalnızca medya paketinden kurtarma denenir
+                const bool has_next = next.occupied && next.sequence == next_sequence_ + 1 &&
+                                      next.payload_type != core::PAYLOAD_TYPE_CN;
+                if (on_data_lost_) {
+                    on_data_lost_(has_next ? next.data : empty_);
+                }
+                stats_.concealed++;
+                conceal_run++;
             } else {
-                ++it;
+                stats_.skipped++;
             }
+            const uint32_t lost_timestamp = expected_timestamp(next_sequence_);
+            has_released_ = true;
+            last_released_sequence_ = next_sequence_;
+            last_released_timestamp_ = lost_timestamp;
+            next_sequence_++;
         }
     }
+
+    const Config config_;
+    mutable std::mutex mutex_;
+    std::array<Slot, SLOT_COUNT> slots_;
+    const std::vector<uint8_t> empty_;
+    OnDataLost on_data_lost_;
+    OnSilence on_silence_;
+    Stats stats_;
+
+    bool is_collecting_ = false;
+    uint32_t ssrc_ = 0;
+    uint32_t next_sequence_ = 0;
+    uint32_t highest_sequence_ = 0;
+    bool has_released_ = false;
+    bool in_silence_ = false;            // Son çıkarılan paket SID'di
+    uint32_t last_released_sequence_ = 0;
+    uint32_t last_released_timestamp_ = 0;
+
+    bool has_origin_ = false;
+    uint32_t timestamp_origin_ = 0;
+    Clock::time_point time_origin_;
+    bool has_transit_ = false;
+    double last_transit_ = 0.0;
+    double base_transit_ = 0.0;
+    double jitter_us_ = 0.0;
 };
 
-Collector::Collector() : impl_(std::make_unique<Impl>()) {}
+Collector::Collector() : impl_(std::make_unique<Impl>(Config{})) {}
+
+Collector::Collector(const Config& config) : impl_(std::make_unique<Impl>(config)) {}
 
 Collector::~Collector() = default;
 
 void Collector::collect(const core::Packet& packet, const OnDataCollected& callback) {
-    impl_->collect(packet, callback);
+    impl_->collect(packet.view(), callback, Clock::now());
+}
+
+void Collector::collect(const core::PacketView& packet, const OnDataCollected& callback) {
+    impl_->collect(packet, callback, Clock::now());
+}
+
+void Collector::collect(const core::PacketView& packet, const OnDataCollected& callback, Clock::time_point arrival) {
+    impl_->collect(packet, callback, arrival);
+}
+
+void Collector::poll(const OnDataCollected& callback) {
+    impl_->poll(callback, Clock::now());
+}
+
+void Collector::poll(const OnDataCollected& callback, Clock::time_point now) {
+    impl_->poll(callback, now);
+}
+
+void Collector::set_silence_callback(OnSilence callback) {
+    impl_->set_silence_callback(std::move(callback));
+}
+
+void Collector::set_loss_callback(OnDataLost callback) {
+    impl_->set_loss_callback(std::move(callback));
 }
 
 void Collector::reset() {
-    impl_->buffer_.reset();
+    impl_->reset();
+}
+
+Collector::Stats Collector::get_stats() const {
+    return impl_->get_stats();
 }
 
 }
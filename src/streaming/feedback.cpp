@@ -0,0 +1,88 @@
+#include "streaming/feedback.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace streaming {
+    FeedbackReporter::FeedbackReporter() : FeedbackReporter(Config{}) {}
+
+    FeedbackReporter::FeedbackReporter(const Config& config) : config_(config) {}
+
+    bool FeedbackReporter::make_report(const Collector::Stats& stats, Clock::time_point now, core::FeedbackReport& report) {
+        has_reported_ = true;
+        next_report_ = now + config_.interval;
+        if (stats.received == 0 && stats.late == 0) {
+            return false;
+        }
+
+        const uint64_t arrived = stats.received + stats.late;
+        uint32_t lost = 0;
+        uint32_t expected = 0;
+        if (!has_baseline_ || stats.ssrc != base_ssrc_ || stats.resets != base_resets_) {
+            // Yeni akış ya da yeniden senkronizasyon: sequence aralığı karşılaştırılamaz
+            has_baseline_ = true;
+            base_ssrc_ = stats.ssrc;
+            base_resets_ = stats.resets;
+        } else {
+            expected = stats.highest_sequence - last_highest_;
+            const uint64_t received = arrived - last_received_;
+            if (expected > received) {
+                lost = static_cast<uint32_t>(expected - received);
+            }
+        }
+        last_highest_ = stats.highest_sequence;
+        last_received_ = arrived;
+        cumulative_lost_ = std::min<uint32_t>(0xFFFFFF, cumulative_lost_ + lost);
+        if (expected == 0) {
+            // Aralıkta yeni sequence yok (konuşma arası, taban çizgisi): kayıp ölçülmedi. fraction_lost = 0
+            // gönderilirse gönderici bunu ölçülmüş sıfır kayıp sanar, FEC'i kapatıp bit hızını artırır.
+            return false;
+        }
+
+        report.media_ssrc = stats.ssrc;
+        report.fraction_lost = static_cast<uint8_t>(std::min<uint64_t>(255, (static_cast<uint64_t>(lost) << 8) / expected));
+        report.cumulative_lost = cumulative_lost_;
+        report.highest_sequence = stats.highest_sequence;
+        report.jitter = static_cast<uint32_t>(stats.jitter_ms * config_.clock_rate / 1000.0);
+        return true;
+    }
+
+    RateController::RateController() : RateController(Config{}, codec::EncoderSettings{}) {}
+
+    RateController::RateController(const Config& config, const codec::EncoderSettings& initial)
+        : config_(config), settings_(initial) {}
+
+    bool RateController::on_feedback(const core::FeedbackReport& report, codec::EncoderSettings& settings) {
+        const double loss = report.loss_ratio();
+        smoothed_loss_ = has_loss_ ? config_.loss_smoothing * smoothed_loss_ + (1.0 - config_.loss_smoothing) * loss : loss;
+        has_loss_ = true;
+
+        codec::EncoderSettings updated = settings_;
+
+        // FEC kararı ortalama kayba göre (tek rapordaki sıçramalar açıp kapatmasın)
+        if (!updated.inband_fec && smoothed_loss_ > config_.fec_on_loss) {
+            updated.inband_fec = true;
+        } else if (updated.inband_fec && smoothed_loss_ < config_.fec_off_loss) {
+            updated.inband_fec = false;
+        }
+        updated.expected_loss_percent = updated.inband_fec
+            ? std::clamp(static_cast<int>(std::ceil(smoothed_loss_ * 100.0)), 1, config_.max_expected_loss_percent)
+            : 0;
+
+        // Bitrate kararı son aralığın kaybına göre
+        double bitrate = static_cast<double>(updated.bitrate);
+        if (loss > config_.high_loss) {
+            bitrate *= 1.0 - 0.5 * loss;
+        } else if (loss < config_.low_loss) {
+            bitrate *= config_.increase_factor;
+        }
+        const int floor = updated.inband_fec ? std::max(config_.min_bitrate, config_.fec_min_bitrate) : config_.min_bitrate;
+        updated.bitrate = std::clamp(static_cast<int>(bitrate), std::min(floor, config_.max_bitrate), config_.max_bitrate);
+
+        const bool changed = updated.bitrate != settings_.bitrate ||
+                             updated.inband_fec != settings_.inband_fec ||
+                             updated.expected_loss_percent != settings_.expected_loss_percent;
+        settings_ = updated;
+        settings = updated;
+        return changed;
+    }
+}
@@ -0,0 +1,153 @@
+// DSP çekirdeklerinin SIMD sürümleri scalar referansla bit düzeyinde karşılaştırılır.
+// Uzunluklar vektör genişliklerinin (8/16) her kalanını, başlangıç kaydırması hizasız yüklemeleri kapsar.
+#include "processing/dsp_kernels.hpp"
+#include <vector>
+#include <random>
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+
+using namespace processing;
+
+namespace {
+    constexpr size_t MAX_LENGTH = 67;
+    const size_t LONG_LENGTHS[] = {480, 960, 4099};
+
+    int failures = 0;
+
+    void report(const char* kernel, const char* level, const char* pattern, size_t length, size_t offset) {
+        if (++failures <= 20) {
+            std::cerr << "HATA: " << kernel << " [" << level << "] desen=" << pattern
+                      << " uzunluk=" << length << " kaydırma=" << offset << std::endl;
+        }
+    }
+
+    // Test desenleri: rastgele, tam ölçek uçları ve işaret sınırı
+    std::vector<int16_t> make_pattern(int pattern, size_t count, std::mt19937& rng) {
+        std::vector<int16_t> samples(count);
+        std::uniform_int_distribution<int> full(-32768, 32767);
+        std::uniform_int_distribution<int> small(-3, 3);
+        for (size_t i = 0; i < count; ++i) {
+            switch (pattern) {
+                case 0: samples[i] = static_cast<int16_t>(full(rng)); break;
+                case 1: samples[i] = -32768; break;
+                case 2: samples[i] = 32767; break;
+                case 3: samples[i] = (i & 1) ? 32767 : -32768; break;
+                case 4: samples[i] = static_cast<int16_t>(small(rng)); break;
+                default: samples[i] = 0; break;
+            }
+        }
+        return samples;
+    }
+
+    const char* PATTERN_NAMES[] = {"rastgele", "-32768", "32767", "uç-dönüşümlü", "küçük", "sıfır"};
+    constexpr int PATTERN_COUNT = 6;
+
+    void check_level(SimdLevel level, std::mt19937& rng) {
+        const DspKernels& reference = dsp_kernels(SimdLevel::Scalar);
+        const DspKernels& kernels = dsp_kernels(level);
+        const char* name = dsp_simd_level_name(level);
+
+        std::vector<size_t> lengths;
+        for (size_t length = 0; length <= MAX_LENGTH; ++length) { lengths.push_back(length); }
+        lengths.insert(lengths.end(), std::begin(LONG_LENGTHS), std::end(LONG_LENGTHS));
+
+        const float gains[] = {0.0f, 1.0f, -1.0f, 0.5f, 1.5f, 2.5f, 3.7f, 0.1f, 65535.0f, -65535.0f};
+        std::uniform_real_distribution<float> random_gain(-4.0f, 4.0f);
+        std::uniform_real_distribution<float> random_step(-0.01f, 0.01f);
+
+        for (int pattern = 0; pattern < PATTERN_COUNT; ++pattern) {
+            const char* pattern_name = PATTERN_NAMES[pattern];
+            for (size_t length : lengths) {
+                for (size_t offset = 0; offset < 2; ++offset) {
+                    const std::vector<int16_t> a_buffer = make_pattern(pattern, length + offset, rng);
+                    const std::vector<int16_t> b_buffer = make_pattern(pattern == 0 ? 0 : (pattern + 1) % PATTERN_COUNT,
+                                                                       length + offset, rng);
+                    const std::vector<int16_t> same_buffer = a_buffer;
+                    const int16_t* a = a_buffer.data() + offset;
+                    const int16_t* b = b_buffer.data() + offset;
+
+                    if (kernels.sum_of_squares(a, length) != reference.sum_of_squares(a, length)) {
+                        report("sum_of_squares", name, pattern_name, length, offset);
+                    }
+                    if (kernels.peak_abs(a, length) != reference.peak_abs(a, length)) {
+                        report("peak_abs", name, pattern_name, length, offset);
+                    }
+                    if (kernels.zero_crossings(a, length) != reference.zero_crossings(a, length)) {
+                        report("zero_crossings", name, pattern_name, length, offset);
+                    }
+                    if (kernels.dot_product(a, b, length) != reference.dot_product(a, b, length)) {
+                        report("dot_product", name, pattern_name, length, offset);
+                    }
+                    // a·a: iki taraf da aynı tam ölçek değerinde (madd çift toplamı taşması)
+                    const int16_t* same = same_buffer.data() + offset;
+                    if (kernels.dot_product(a, same, length) != reference.dot_product(a, same, length)) {
+                        report("dot_product(a,a)", name, pattern_name, length, offset);
+                    }
+
+                    std::vector<int16_t> expected(a, a + length);
+                    std::vector<int16_t> actual(a, a + length);
+                    reference.mix_saturate(expected.data(), b, length);
+                    kernels.mix_saturate(actual.data(), b, length);
+                    if (actual != expected) { report("mix_saturate", name, pattern_name, length, offset); }
+
+                    expected.assign(a, a + length);
+                    actual.assign(a, a + length);
+                    reference.subtract_saturate(expected.data(), b, length);
+                    kernels.subtract_saturate(actual.data(), b, length);
+                    if (actual != expected) { report("subtract_saturate", name, pattern_name, length, offset); }
+
+                    for (float gain : gains) {
+                        expected.assign(a, a + length);
+                        actual.assign(a, a + length);
+                        reference.apply_gain(expected.data(), length, gain);
+                        kernels.apply_gain(actual.data(), length, gain);
+                        if (actual != expected) { report("apply_gain", name, pattern_name, length, offset); }
+                    }
+                    expected.assign(a, a + length);
+                    actual.assign(a, a + length);
+                    const float gain = random_gain(rng);
+                    reference.apply_gain(expected.data(), length, gain);
+                    kernels.apply_gain(actual.data(), length, gain);
+                    if (actual != expected) { report("apply_gain", name, pattern_name, length, offset); }
+
+                    // Rampa: sabit (step 0), tam ölçeğe çıkan/inen ve rastgele
+                    const float ramps[][2] = {
+                        {1.0f, 0.0f},
+                        {0.0f, length > 0 ? 2.0f / static_cast<float>(length) : 0.0f},
+                        {3.0f, length > 0 ? -2.9f / static_cast<float>(length) : 0.0f},
+                        {random_gain(rng), random_step(rng)},
+                    };
+                    for (const auto& ramp : ramps) {
+                        expected.assign(a, a + length);
+                        actual.assign(a, a + length);
+                        reference.apply_gain_ramp(expected.data(), length, ramp[0], ramp[1]);
+                        kernels.apply_gain_ramp(actual.data(), length, ramp[0], ramp[1]);
+                        if (actual != expected) { report("apply_gain_ramp", name, pattern_name, length, offset); }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main() {
+    std::mt19937 rng(20240611u);
+    const SimdLevel levels[] = {SimdLevel::Sse2, SimdLevel::Avx2};
+    for (SimdLevel level : levels) {
+        check_level(level, rng);
+    }
+
+    // Scalar referansın kendisi: bilinen değerler
+    const DspKernels& scalar = dsp_kernels(SimdLevel::Scalar);
+    const std::vector<int16_t> minimum(16, -32768);
+    if (scalar.sum_of_squares(minimum.data(), minimum.size()) != 16ull * 32768ull * 32768ull ||
+        scalar.dot_product(minimum.data(), minimum.data(), minimum.size()) != 16ll * 32768ll * 32768ll ||
+        scalar.peak_abs(minimum.data(), minimum.size()) != 32768) {
+        report("scalar", "scalar", "-32768", minimum.size(), 0);
+    }
+
+    std::cout << "DSP çekirdek testi (en iyi seviye: " << dsp_simd_level_name(dsp_simd_level()) << "): "
+              << (failures == 0 ? "başarılı" : "BAŞARISIZ") << " - " << failures << " hata" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,208 @@
+// Pipeline'ın birleştirdiği örnek döngüsü, aşamaların ayrı ayrı çalıştırılmasıyla bit düzeyinde karşılaştırılır.
+// Referans: çerçeve bir kez float'a açılır, her aşama float tampon üzerinde sırayla tam geçiş yapar,
+// sonra tek lrintf + doyurma ile geri yazılır; blok aşaması bu dönüşümün sınırıdır.
+#include "processing/pipeline.hpp"
+#include <vector>
+#include <random>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+using namespace processing;
+
+namespace {
+    constexpr size_t FRAME_SAMPLES = 480;
+    constexpr size_t FRAME_COUNT = 200;
+
+    int failures = 0;
+
+    void report(const char* chain, const char* what, size_t frame) {
+        if (++failures <= 20) {
+            std::cerr << "HATA: " << chain << " " << what << " çerçeve=" << frame << std::endl;
+        }
+    }
+
+    // Test aşamaları: toplama, çarpma (taşmayı zorlar), salt okunur ölçüm, işarete bağlı kazanç
+    class OffsetStage {
+    public:
+        struct Config { float offset = 0.0f; };
+        OffsetStage() : OffsetStage(Config{}) {}
+        explicit OffsetStage(const Config& config) : offset_(config.offset) {}
+        float process_sample(float value) { return value + offset_; }
+    private:
+        float offset_;
+    };
+
+    class ScaleStage {
+    public:
+        struct Config { float gain = 1.0f; };
+        ScaleStage() : ScaleStage(Config{}) {}
+        explicit ScaleStage(const Config& config) : gain_(config.gain) {}
+        float process_sample(float value) { return value * gain_; }
+    private:
+        float gain_;
+    };
+
+    class EnergyStage {
+    public:
+        struct Config {};
+        EnergyStage() = default;
+        explicit EnergyStage(const Config&) {}
+        void begin_frame(FrameContext&) { sum_ = 0.0; }
+        void observe_sample(float value) { sum_ += static_cast<double>(value) * static_cast<double>(value); }
+        void end_frame(FrameContext& context) { last_ = sum_; context.voice = sum_ > 0.0; }
+        double last() const { return last_; }
+    private:
+        double sum_ = 0.0;
+        double last_ = 0.0;
+    };
+
+    class AsymmetricStage {
+    public:
+        struct Config { float negative_gain = 0.75f; };
+        AsymmetricStage() : AsymmetricStage(Config{}) {}
+        explicit AsymmetricStage(const Config& config) : negative_gain_(config.negative_gain) {}
+        float process_sample(float value) { return value < 0.0f ? value * negative_gain_ : value; }
+    private:
+        float negative_gain_;
+    };
+
+    // Blok aşaması: çerçeveyi tersine çevirir (örnekler arası bağımlılık, birleştirilemez)
+    class ReverseStage {
+    public:
+        struct Config {};
+        ReverseStage() = default;
+        explicit ReverseStage(const Config&) {}
+        void process_frame(FrameContext& context) {
+            std::vector<int16_t>& samples = context.frame.mutable_samples();
+            std::reverse(samples.begin(), samples.end());
+        }
+    };
+
+    const OffsetStage::Config OFFSET{137.25f};
+    const ScaleStage::Config SCALE{2.6f};
+    const AsymmetricStage::Config ASYMMETRIC{0.61f};
+
+    // Referans yardımcıları
+    std::vector<float> to_float(const std::vector<int16_t>& samples) {
+        return std::vector<float>(samples.begin(), samples.end());
+    }
+
+    std::vector<int16_t> to_int16(const std::vector<float>& values) {
+        std::vector<int16_t> samples(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            samples[i] = static_cast<int16_t>(std::lrintf(std::clamp(values[i], -32768.0f, 32767.0f)));
+        }
+        return samples;
+    }
+
+    template <typename Stage>
+    void run_separately(Stage& stage, std::vector<float>& buffer) {
+        for (float& value : buffer) { value = stage.process_sample(value); }
+    }
+
+    double run_energy(EnergyStage& stage, const std::vector<float>& buffer, AudioFrame& frame) {
+        FrameContext context{frame};
+        stage.begin_frame(context);
+        for (float value : buffer) { stage.observe_sample(value); }
+        stage.end_frame(context);
+        return stage.last();
+    }
+
+    // Desenler: rastgele tam ölçek (doyurma), küçük genlik, sıfır ve tam ölçek rampa
+    std::vector<int16_t> make_frame(size_t index, std::mt19937& rng) {
+        std::vector<int16_t> samples(FRAME_SAMPLES);
+        std::uniform_int_distribution<int> full(-32768, 32767);
+        std::uniform_int_distribution<int> small(-300, 300);
+        for (size_t i = 0; i < FRAME_SAMPLES; ++i) {
+            switch (index % 4) {
+                case 0: samples[i] = static_cast<int16_t>(full(rng)); break;
+                case 1: samples[i] = static_cast<int16_t>(small(rng)); break;
+                case 2: samples[i] = 0; break;
+                default: samples[i] = static_cast<int16_t>(static_cast<int>(i * 137 % 65536) - 32768); break;
+            }
+        }
+        return samples;
+    }
+
+    // Tamamı örnek aşaması: tek geçiş
+    void check_fused(std::mt19937& rng) {
+        using Chain = Pipeline<FRAME_SAMPLES, 1, OffsetStage, ScaleStage, EnergyStage, AsymmetricStage>;
+        static_assert(Chain::pass_count() == 1, "Ardışık örnek aşamaları tek geçişte birleşmeli");
+        Chain pipeline(OFFSET, SCALE, EnergyStage::Config{}, ASYMMETRIC);
+        OffsetStage offset(OFFSET);
+        ScaleStage scale(SCALE);
+        EnergyStage energy;
+        AsymmetricStage asymmetric(ASYMMETRIC);
+
+        AudioFrame frame;
+        AudioFrame reference_frame;
+        for (size_t index = 0; index < FRAME_COUNT; ++index) {
+            const std::vector<int16_t> input = make_frame(index, rng);
+
+            std::vector<float> buffer = to_float(input);
+            run_separately(offset, buffer);
+            run_separately(scale, buffer);
+            reference_frame.assign(input.data(), input.size());
+            const double expected_energy = run_energy(energy, buffer, reference_frame);
+            run_separately(asymmetric, buffer);
+            const std::vector<int16_t> expected = to_int16(buffer);
+
+            frame.assign(input.data(), input.size());
+            size_t passes = 0;
+            pipeline.process(frame, [&](size_t) { ++passes; });
+            if (frame.samples() != expected) { report("birleşik", "çıkış", index); }
+            if (pipeline.stage<EnergyStage>().last() != expected_energy) { report("birleşik", "enerji", index); }
+            if (passes != 1) { report("birleşik", "geçiş sayısı", index); }
+        }
+    }
+
+    // Arada blok aşaması: iki örnek grubu, her grup kendi float dönüşümü ve tek doyurmasıyla
+    void check_split(std::mt19937& rng) {
+        using Chain = Pipeline<FRAME_SAMPLES, 1, OffsetStage, ScaleStage, ReverseStage, EnergyStage, AsymmetricStage>;
+        static_assert(Chain::pass_count() == 3, "Blok aşaması örnek gruplarını ayırmalı");
+        Chain pipeline(OFFSET, SCALE, ReverseStage::Config{}, EnergyStage::Config{}, ASYMMETRIC);
+        OffsetStage offset(OFFSET);
+        ScaleStage scale(SCALE);
+        ReverseStage reverse;
+        EnergyStage energy;
+        AsymmetricStage asymmetric(ASYMMETRIC);
+
+        AudioFrame frame;
+        AudioFrame reference_frame;
+        for (size_t index = 0; index < FRAME_COUNT; ++index) {
+            const std::vector<int16_t> input = make_frame(index, rng);
+
+            std::vector<float> buffer = to_float(input);
+            run_separately(offset, buffer);
+            run_separately(scale, buffer);
+            const std::vector<int16_t> first_group = to_int16(buffer);
+            reference_frame.assign(first_group.data(), first_group.size());
+            FrameContext context{reference_frame};
+            reverse.process_frame(context);
+            buffer = to_float(reference_frame.samples());
+            const double expected_energy = run_energy(energy, buffer, reference_frame);
+            run_separately(asymmetric, buffer);
+            const std::vector<int16_t> expected = to_int16(buffer);
+
+            frame.assign(input.data(), input.size());
+            std::vector<size_t> pass_starts;
+            pipeline.process(frame, [&](size_t stage) { pass_starts.push_back(stage); });
+            if (frame.samples() != expected) { report("bölünmüş", "çıkış", index); }
+            if (pipeline.stage<EnergyStage>().last() != expected_energy) { report("bölünmüş", "enerji", index); }
+            if (pass_starts != std::vector<size_t>{0, 2, 3}) { report("bölünmüş", "geçiş başlangıçları", index); }
+        }
+    }
+}
+
+int main() {
+    std::mt19937 rng(20240612u);
+    check_fused(rng);
+    check_split(rng);
+
+    std::cout << "Pipeline birleştirme testi: " << (failures == 0 ? "başarılı" : "BAŞARISIZ")
+              << " - " << failures << " hata" << std::endl;
+    return failures == 0 ? 0 : 1;
+}